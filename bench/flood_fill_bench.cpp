@@ -0,0 +1,185 @@
+#include "FloodFill.hpp"
+
+#include <fmt/core.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <random>
+
+namespace
+{
+	/// Minimal time spent per measurement, to keep the timer resolution out of the results
+	constexpr std::chrono::milliseconds minimalDuration{ 200 };
+
+	/// Breadth first search over a byte per cell, the scalar approach the bitboard kernel is measured against
+	class ScalarBoard
+	{
+		std::int32_t mWidth;
+		std::int32_t mHeight;
+		std::vector<std::uint8_t> mIsBlocked;
+		std::vector<std::uint8_t> mIsReached;
+		std::vector<std::int32_t> mQueue;
+
+	 public:
+		explicit ScalarBoard(const Snake::Point& gameFrameDimension)
+			: mWidth(gameFrameDimension.first + 1), mHeight(gameFrameDimension.second + 1),
+			  mIsBlocked(static_cast<std::size_t>(mWidth * mHeight), 0), mIsReached(mIsBlocked.size(), 0), mQueue()
+		{
+			mQueue.reserve(mIsBlocked.size());
+		}
+
+		auto setBlocked(const Snake::Point& point, const bool isBlocked) -> void
+		{
+			mIsBlocked[this->getIndex(point)] = isBlocked;
+		}
+
+		auto analyse(const std::deque<Snake::Point>& body) -> FloodFill::Result
+		{
+			for (const auto& point: body)
+			{
+				this->setBlocked(point, true);
+			}
+			std::ranges::fill(mIsReached, 0);
+			mQueue.clear();
+
+			const auto [headX, headY] = body.front();
+			this->visitNeighbours(headY * mWidth + headX);
+			for (std::size_t i{ 0 }; i < mQueue.size(); ++i)
+			{
+				this->visitNeighbours(mQueue[i]);
+			}
+
+			const auto [tailX, tailY] = body.back();
+			bool isTailReachable{ false };
+			for (const auto neighbour: this->getNeighbours(tailY * mWidth + tailX))
+			{
+				isTailReachable |= neighbour == headY * mWidth + headX || mIsReached[static_cast<std::size_t>(neighbour)];
+			}
+
+			for (const auto& point: body)
+			{
+				this->setBlocked(point, false);
+			}
+			return { mQueue.size(), isTailReachable };
+		}
+
+	 private:
+		auto visitNeighbours(const std::int32_t cell) -> void
+		{
+			for (const auto neighbour: this->getNeighbours(cell))
+			{
+				const auto index{ static_cast<std::size_t>(neighbour) };
+				if (!mIsBlocked[index] && !mIsReached[index])
+				{
+					mIsReached[index] = true;
+					mQueue.push_back(neighbour);
+				}
+			}
+		}
+
+		auto getNeighbours(const std::int32_t cell) const -> std::array<std::int32_t, 4>
+		{
+			const std::int32_t x{ cell % mWidth };
+			const std::int32_t y{ cell / mWidth };
+			return { (y + mHeight - 1) % mHeight * mWidth + x, y * mWidth + (x + 1) % mWidth,
+			         (y + 1) % mHeight * mWidth + x, y * mWidth + (x + mWidth - 1) % mWidth };
+		}
+
+		auto getIndex(const Snake::Point& point) const -> std::size_t
+		{
+			return static_cast<std::size_t>(point.second * mWidth + point.first);
+		}
+	};
+
+	/// Average time per call in microseconds
+	auto measure(const std::function<FloodFill::Result()>& analyse) -> double
+	{
+		using Clock = std::chrono::steady_clock;
+		std::size_t calls{ 0 };
+		const auto start{ Clock::now() };
+		auto now{ start };
+		while (now - start < minimalDuration)
+		{
+			analyse();
+			++calls;
+			now = Clock::now();
+		}
+		return std::chrono::duration<double, std::micro>(now - start).count() / static_cast<double>(calls);
+	}
+
+	/// Snake coiled up row by row over the upper half of the board, its head ending the last row
+	auto createCoiledSnake(const std::int32_t size) -> std::deque<Snake::Point>
+	{
+		std::deque<Snake::Point> body{};
+		for (std::int32_t y{ 0 }; y < size / 2; ++y)
+		{
+			for (std::int32_t i{ 0 }; i < size; ++i)
+			{
+				body.emplace_front(y % 2 == 0 ? i : size - 1 - i, y);
+			}
+		}
+		return body;
+	}
+
+	/// Random obstacles around a snake in the middle row, blocked in both boards
+	template<typename Board>
+	auto placeObstacles(Board& board, const std::int32_t size, const double density) -> void
+	{
+		std::mt19937 generator{ 42 };
+		std::bernoulli_distribution isBlocked{ density };
+		for (std::int32_t y{ 0 }; y < size; ++y)
+		{
+			for (std::int32_t x{ 0 }; x < size; ++x)
+			{
+				board.setBlocked({ x, y }, y != size / 2 && isBlocked(generator));
+			}
+		}
+	}
+}
+
+auto main() -> int
+{
+	fmt::print("{:>10} {:>10} {:>10} {:>15} {:>15} {:>8}\n", "board", "layout", "reachable", "scalar bfs [us]",
+		"bitboard [us]", "speedup");
+
+	for (const std::int32_t size: { 15, 64, 256, 1024 })
+	{
+		const Snake::Point gameFrameDimension{ size - 1, size - 1 };
+		const std::deque<Snake::Point> straightSnake{ [&]
+		{
+		  std::deque<Snake::Point> body{};
+		  for (std::int32_t x{ 0 }; x < std::min(size, 64); ++x)
+		  {
+			  body.emplace_front(x, size / 2);
+		  }
+		  return body;
+		}() };
+
+		for (const auto& [layout, body, density]: {
+			std::tuple{ "open", straightSnake, 0.0 },
+			std::tuple{ "obstacles", straightSnake, 0.3 },
+			std::tuple{ "coiled", createCoiledSnake(size), 0.0 }})
+		{
+			ScalarBoard scalarBoard{ gameFrameDimension };
+			FloodFill floodFill{ gameFrameDimension };
+			placeObstacles(scalarBoard, size, density);
+			placeObstacles(floodFill, size, density);
+
+			const FloodFill::Result expected{ scalarBoard.analyse(body) };
+			const FloodFill::Result result{ floodFill.analyse(body) };
+			if (result.reachableCells != expected.reachableCells || result.isTailReachable != expected.isTailReachable)
+			{
+				fmt::print(stderr, "Bitboard result differs from the scalar one on the {}x{} {} board\n", size, size,
+					layout);
+				return EXIT_FAILURE;
+			}
+
+			const double scalarTime{ measure([&] { return scalarBoard.analyse(body); }) };
+			const double bitboardTime{ measure([&] { return floodFill.analyse(body); }) };
+			fmt::print("{:>10} {:>10} {:>10d} {:>15.2f} {:>15.2f} {:>7.1f}x\n", fmt::format("{}x{}", size, size), layout,
+				expected.reachableCells, scalarTime, bitboardTime, scalarTime / bitboardTime);
+		}
+	}
+	return EXIT_SUCCESS;
+}
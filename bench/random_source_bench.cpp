@@ -0,0 +1,49 @@
+#include "RandomSource.hpp"
+
+#include <fmt/core.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+namespace
+{
+	constexpr std::size_t draws{ 100'000'000 };
+
+	/// Million snack coordinates drawn per second. The sum is printed, so the compiler can't skip the drawing
+	template<typename DrawCoordinate>
+	auto measure(const char* name, std::size_t stateSize, DrawCoordinate&& drawCoordinate) -> void
+	{
+		using Clock = std::chrono::steady_clock;
+		std::int64_t sum{ 0 };
+		const auto start{ Clock::now() };
+		for (std::size_t i{ 0 }; i < draws; ++i)
+		{
+			sum += drawCoordinate();
+		}
+		const std::chrono::duration<double> duration{ Clock::now() - start };
+		fmt::print("{:>32} {:>12d} {:>14.1f} {:>16d}\n", name, stateSize,
+			static_cast<double>(draws) / duration.count() / 1e6, sum);
+	}
+}
+
+auto main() -> int
+{
+	fmt::print("{:>32} {:>12} {:>14} {:>16}\n", "generator", "state [B]", "draws [M/s]", "checksum");
+
+	// Game frame coordinate of the default (14,14) frame, like the snack placement draws them
+	std::mt19937 mersenneTwister{ 42 };
+	std::uniform_int_distribution<std::int32_t> distribution{ 0, 14 };
+	measure("mt19937 & uniform_int_distribution", sizeof(mersenneTwister), [&]
+	{
+	  return distribution(mersenneTwister);
+	});
+
+	CounterRandomSource counterSource{ 42, 0 };
+	measure("CounterRandomSource", sizeof(counterSource), [&]
+	{
+	  return counterSource.nextInRange(0, 14);
+	});
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+#include "ReplayRenderer.hpp"
+
+#include <QGuiApplication>
+#include <spdlog/spdlog.h>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+	constexpr std::size_t replayCount{ 64 };
+	/// Upper bound of the moves per replay, the snake might bite itself earlier
+	constexpr std::size_t maximalMoves{ 1'000 };
+
+	/// Seeded replay of a snake chasing its snacks on the default board, like the game would log it
+	auto writeReplay(const std::filesystem::path& path, const std::uint64_t gameId) -> void
+	{
+		constexpr std::uint64_t seed{ 42 };
+		Snake snake{{ 14, 14 }};
+		CounterRandomSource randomSource{ seed, gameId };
+		Snake::Point snack{ snake.generateSnack(randomSource) };
+		std::string moves{};
+		for (std::size_t i{ 0 }; i < maximalMoves && !snake.isDead(); ++i)
+		{
+			const auto [xHead, yHead] = snake.getBody().front();
+			using enum Snake::Direction;
+			const auto direction{ xHead != snack.first ? (xHead < snack.first ? EAST : WEST)
+			                                           : (yHead < snack.second ? SOUTH : NORTH) };
+			moves += "NESW"[static_cast<std::size_t>(direction)];
+
+			snake.turn(direction);
+			if (snake.move(snack))
+			{
+				snack = snake.generateSnack(randomSource);
+			}
+		}
+		std::ofstream{ path } << fmt::format("seed {:d} {:d}\nmoves {}\n", seed, gameId, moves);
+	}
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+	if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+	{
+		qputenv("QT_QPA_PLATFORM", "offscreen");
+	}
+	QGuiApplication app{ argc, argv };
+	spdlog::set_level(spdlog::level::warn);
+
+	const std::filesystem::path directory{ std::filesystem::temp_directory_path() / "snake_replay_render_bench" };
+	std::filesystem::create_directories(directory);
+	std::vector<std::filesystem::path> replayPaths{};
+	for (std::uint64_t gameId{ 0 }; gameId < replayCount; ++gameId)
+	{
+		replayPaths.push_back(directory / fmt::format("game_{:d}.replay", gameId));
+		writeReplay(replayPaths.back(), gameId);
+	}
+
+	fmt::print("{:>8} {:>16} {:>8} {:>10} {:>12}\n", "format", "frames per move", "threads", "frames", "frames/s");
+	const unsigned int threadCount{ std::max(std::thread::hardware_concurrency(), 1U) };
+	for (const auto& [name, format]: { std::pair{ "raw", ReplayRenderer::Format::RAW },
+	                                   std::pair{ "ppm", ReplayRenderer::Format::PPM }})
+	{
+		for (const std::int32_t framesPerMove: { 1, 4 })
+		{
+			for (const unsigned int threads: { 1U, threadCount })
+			{
+				ReplayRenderer renderer{ directory / "frames", format, framesPerMove };
+				const ReplayRenderer::Result result{ renderer.render(replayPaths, threads) };
+				std::filesystem::remove_all(directory / "frames");
+				if (result.failedReplays != 0)
+				{
+					fmt::print(stderr, "Rendering {:d} replays failed\n", result.failedReplays);
+					return EXIT_FAILURE;
+				}
+				fmt::print("{:>8} {:>16d} {:>8d} {:>10d} {:>12.0f}\n", name, framesPerMove, threads, result.framesWritten,
+					static_cast<double>(result.framesWritten) / result.renderTime.count());
+			}
+		}
+	}
+
+	std::filesystem::remove_all(directory);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,262 @@
+#include "Snake.hpp"
+
+#include <fmt/core.h>
+#include <fmt/ranges.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <variant>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr std::int32_t mapDimension{ 4095 };
+	constexpr std::int32_t loopSize{ 64 };
+	constexpr std::size_t moves{ 20'000'000 };
+	/// The fastest of these runs is taken. The variants take turns, so load of the machine hits all of them alike
+	constexpr std::size_t runs{ 5 };
+
+	/**
+	 * Snake::move() like it was before the rules became template parameters, the baseline of all variants. Copied
+	 * together with the border handling it called. The rest of the snake is taken from SnakeBase, including the
+	 * direction lookup of the trimmed tail, so only the move & rule code differs from the measured variants.
+	 */
+	class OriginalSnake : public SnakeBase
+	{
+	 public:
+		OriginalSnake(const Point& gameFrameDimension, const Point& start)
+			: SnakeBase(gameFrameDimension, start, Direction::EAST, 4, mDefaultSpeedUpCountDown, mDefaultRewindCapacity)
+		{
+		}
+
+		/// Kept out of line like it was in Snake.cpp, otherwise inlining it into the loop would speed up the baseline
+		[[gnu::noinline]] auto move(const Point& snackPosition) -> bool
+		{
+			TickDelta delta{
+				static_cast<std::int16_t>(snackPosition.first), static_cast<std::int16_t>(snackPosition.second),
+				static_cast<std::uint8_t>(mViewDirection), static_cast<std::uint8_t>(mTailDirection), 0, false, false };
+
+			const auto [xRelativeMoving, yRelativeMoving]{ getDirectionsRelativeCoords(mViewDirection) };
+			const auto [xCurrentHead, yCurrentHead] = mBody.front();
+			Point newHeadPosition{ xCurrentHead + xRelativeMoving, yCurrentHead + yRelativeMoving };
+
+			// Snake is moving about a border
+			changeToPlayFieldAwarePosition(newHeadPosition);
+
+			mBody.push_front(newHeadPosition);
+
+			// Snake grows and maybe levels up if a snack is eaten, else the size stays the same.
+			mPreviousTail = mBody.back();
+			bool ateSnack{ false };
+			if (this->isOnSnack(snackPosition))
+			{
+				ateSnack = true;
+				delta.ateSnack = true;
+				mConsoleLogger->info("Ate snack on position {}. Adjusting size to {}", mBody.front(), this->getLength());
+				// Level up semantic
+				if (--mCurrentSpeedUpCountDown == 0)
+				{
+					mCurrentSpeedUpCountDown = ++mCurrentSpeedUpCountDownStart;
+					this->levelUp();
+					delta.leveledUp = true;
+				}
+			}
+			else
+			{
+				mBody.pop_back();
+				delta.trimmedTailDirection = static_cast<std::uint8_t>(SnakeBase::getDirectionBetween(mBody.back(),
+					mPreviousTail));
+			}
+
+			// The tail direction is set here to ensure the snake cant eat itself by turning 180°
+			mTailDirection = getOpposite(mViewDirection);
+			mHistory.push(delta);
+			return ateSnack;
+		}
+
+		auto isDead() -> bool
+		{
+			return this->isEatingItself();
+		}
+
+	 private:
+		auto changeToPlayFieldAwarePosition(Point& point) -> void
+		{
+			auto& [x, y] = point;
+			auto& [xGameDimension, yGameDimension] = mGameFrameDimension;
+
+			if (y < 0)
+			{
+				y += yGameDimension + 1;
+			}
+			else if (yGameDimension < y)
+			{
+				y -= yGameDimension + 1;
+			}
+			else if (x < 0)
+			{
+				x += xGameDimension + 1;
+			}
+			else if (xGameDimension < x)
+			{
+				x -= xGameDimension + 1;
+			}
+		}
+	};
+
+	/// The snake like the game holds it, dispatching on the rules of the RuleSet with std::visit on every move
+	class RuleSetSnake
+	{
+		RuleSet::AnySnake mSnake;
+
+	 public:
+		explicit RuleSetSnake(RuleSet::AnySnake snake)
+			: mSnake(std::move(snake))
+		{
+		}
+
+		auto turn(const Snake::Direction direction) -> void
+		{
+			RuleSet::getBase(mSnake).turn(direction);
+		}
+		auto move(const Snake::Point& snackPosition) -> bool
+		{
+			return std::visit([&](auto& snake)
+			{
+			  return snake.move(snackPosition);
+			}, mSnake);
+		}
+		auto isDead() -> bool
+		{
+			return std::visit([](auto& snake)
+			{
+			  return snake.isDead();
+			}, mSnake);
+		}
+	};
+
+	/// Runs of a rule variant, each one moving the snake & returning the time per move in nanoseconds
+	using Runner = std::function<double()>;
+
+	/// The snake runs in a square around the middle of the board, never touching the snack, a wall or the border
+	template<typename SnakeType>
+	auto createRunner(const char* name, SnakeType snake) -> Runner
+	{
+		// Shared, as std::function needs a copyable function & the snakes can only be moved
+		auto runLoops{ [name, snake{ std::make_shared<SnakeType>(std::move(snake)) }, moveIndex{ std::size_t{ 0 }}](
+			const std::size_t moveCount) mutable
+		{
+		  constexpr std::array directions{ Snake::Direction::EAST, Snake::Direction::SOUTH, Snake::Direction::WEST,
+		                                   Snake::Direction::NORTH };
+		  const Snake::Point snack{ 0, 0 };
+		  std::size_t snacksEaten{ 0 };
+		  const auto start{ Clock::now() };
+		  for (const std::size_t end{ moveIndex + moveCount }; moveIndex < end; ++moveIndex)
+		  {
+			  snake->turn(directions[moveIndex / loopSize % directions.size()]);
+			  snacksEaten += snake->move(snack);
+		  }
+		  const std::chrono::duration<double, std::nano> duration{ Clock::now() - start };
+
+		  if (snake->isDead() || snacksEaten != 0)
+		  {
+			  fmt::print(stderr, "The {} snake left its loop\n", name);
+			  std::exit(EXIT_FAILURE);
+		  }
+		  return duration.count() / static_cast<double>(moveCount);
+		} };
+
+		// Warming up fills the rewind history, so every measured move overwrites its oldest entry
+		runLoops(Snake::mDefaultRewindCapacity);
+		return [runLoops]() mutable
+		{
+		  return runLoops(moves);
+		};
+	}
+
+	/// Walls on every 7th cell, except for the loop of the snake
+	auto createWalls() -> std::vector<GameMap::Point>
+	{
+		const std::int32_t loopStart{ mapDimension / 2 };
+		const auto isOnLoop{ [&](const std::int32_t x, const std::int32_t y)
+		{
+		  return loopStart - 4 <= x && x <= loopStart + loopSize + 4 && loopStart - 4 <= y && y <= loopStart + loopSize + 4;
+		} };
+
+		std::vector<GameMap::Point> walls{};
+		for (std::int32_t y{ 0 }; y <= mapDimension; ++y)
+		{
+			for (std::int32_t x{ 0 }; x <= mapDimension; ++x)
+			{
+				if ((y * (mapDimension + 1) + x) % 7 == 0 && !isOnLoop(x, y))
+				{
+					walls.emplace_back(x, y);
+				}
+			}
+		}
+		return walls;
+	}
+}
+
+auto main() -> int
+{
+	spdlog::set_level(spdlog::level::warn);
+
+	const auto mapPath{ std::filesystem::temp_directory_path() / "snake_rules_bench.map" };
+	const Snake::Point spawn{ mapDimension / 2, mapDimension / 2 };
+	GameMap::save(mapPath, { mapDimension, mapDimension }, spawn, static_cast<std::uint32_t>(Snake::Direction::EAST),
+		createWalls());
+
+	// Memory mapping only reads the header, parsing would read the whole file
+	auto start{ Clock::now() };
+	const auto gameMap{ std::make_shared<const GameMap>(GameMap::load(mapPath)) };
+	const std::chrono::duration<double, std::micro> mappingTime{ Clock::now() - start };
+	start = Clock::now();
+	std::ifstream mapFile{ mapPath, std::ios::binary };
+	const std::vector<char> mapContent{ std::istreambuf_iterator<char>{ mapFile }, std::istreambuf_iterator<char>{}};
+	const std::chrono::duration<double, std::micro> readingTime{ Clock::now() - start };
+	fmt::print("Loading a ({:d},{:d}) map of {:d} bytes: {:.1f}us mapped, {:.1f}us read\n\n", mapDimension, mapDimension,
+		mapContent.size(), mappingTime.count(), readingTime.count());
+
+	const Snake::Point gameFrameDimension{ gameMap->getGameFrameDimension() };
+	std::vector<std::pair<const char*, Runner>> variants{};
+	variants.emplace_back("original Snake::move()", createRunner("original", OriginalSnake{ gameFrameDimension, spawn }));
+	variants.emplace_back("Snake", createRunner("Snake", Snake{ gameFrameDimension, spawn }));
+	variants.emplace_back("solid border",
+		createRunner("solid border", BasicSnake<Rules::SolidBorder>{ gameFrameDimension, spawn }));
+	variants.emplace_back("wrap around & obstacles", createRunner("wrap around & obstacles",
+		BasicSnake<Rules::WrapAround, Rules::MapObstacles>::fromMap(gameMap)));
+	variants.emplace_back("solid border & obstacles", createRunner("solid border & obstacles",
+		BasicSnake<Rules::SolidBorder, Rules::MapObstacles>::fromMap(gameMap)));
+	// Chosen at runtime like in the game, compared with the rows of the same rules above this is the dispatch cost
+	variants.emplace_back("RuleSet: Snake",
+		createRunner("RuleSet: Snake", RuleSetSnake{ RuleSet{}.createSnake(gameFrameDimension) }));
+	variants.emplace_back("RuleSet: solid & obstacles", createRunner("RuleSet: solid & obstacles",
+		RuleSetSnake{ RuleSet{ true, gameMap }.createSnake(gameFrameDimension) }));
+
+	std::vector<double> moveTimes(variants.size(), std::numeric_limits<double>::max());
+	for (std::size_t run{ 0 }; run < runs; ++run)
+	{
+		for (std::size_t i{ 0 }; i < variants.size(); ++i)
+		{
+			moveTimes[i] = std::min(moveTimes[i], variants[i].second());
+		}
+	}
+
+	fmt::print("{:>28} {:>12} {:>14}\n", "rules", "move [ns]", "vs. original");
+	for (std::size_t i{ 0 }; i < variants.size(); ++i)
+	{
+		fmt::print("{:>28} {:>12.2f} {:>+13.1f}%\n", variants[i].first, moveTimes[i],
+			(moveTimes[i] / moveTimes.front() - 1) * 100);
+	}
+
+	std::filesystem::remove(mapPath);
+	return EXIT_SUCCESS;
+}
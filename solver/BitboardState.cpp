@@ -0,0 +1,160 @@
+#include "BitboardState.hpp"
+#include "ZobristHash.hpp"
+
+#include <stdexcept>
+
+namespace
+{
+	constexpr auto getOpposite(const std::uint8_t direction) -> std::uint8_t
+	{
+		return static_cast<std::uint8_t>((direction + 2) % 4);
+	}
+}
+
+BitboardState::Board::Board(const Snake::Point& gameFrameDimension)
+	: width(gameFrameDimension.first + 1), height(gameFrameDimension.second + 1), cells(width * height), neighbours()
+{
+	if (width <= 0 || height <= 0 || mMaxCells < cells)
+	{
+		throw std::runtime_error{ "the solver supports boards of up to 256 cells" };
+	}
+
+	neighbours.resize(static_cast<std::size_t>(cells));
+	for (std::int32_t y{ 0 }; y < height; ++y)
+	{
+		for (std::int32_t x{ 0 }; x < width; ++x)
+		{
+			// Same order as Snake::Direction, wrapping around the borders like the snake does
+			neighbours[static_cast<std::size_t>(toCell({ x, y }))] = {
+				static_cast<std::uint8_t>(toCell({ x, (y + height - 1) % height })),
+				static_cast<std::uint8_t>(toCell({ (x + 1) % width, y })),
+				static_cast<std::uint8_t>(toCell({ x, (y + 1) % height })),
+				static_cast<std::uint8_t>(toCell({ (x + width - 1) % width, y })) };
+		}
+	}
+}
+
+auto BitboardState::Board::toCell(const Snake::Point& point) const -> std::int32_t
+{
+	return point.second * width + point.first;
+}
+
+BitboardState::BitboardState(const Board& board, const Snake::Point& start, const Snake::Direction direction,
+	const std::int32_t length)
+	: mOccupied(), mChain(), mHash(0), mChainStart(0), mLength(0), mHead(0), mTail(0), mSnack(mNoSnack)
+{
+	if (length < 2 || board.cells < length)
+	{
+		throw std::runtime_error{ "snake length out of range" };
+	}
+
+	// The body grows in the opposite of the viewing direction, so every segment points the same way to its successor
+	const auto towardsTail{ getOpposite(static_cast<std::uint8_t>(direction)) };
+	std::int32_t cell{ board.toCell(start) };
+	mHead = static_cast<std::uint8_t>(cell);
+	for (std::int32_t segment{ 0 }; segment < length; ++segment)
+	{
+		setOccupied(cell, true);
+		if (segment + 1 < length)
+		{
+			setChainDirection(segment, towardsTail);
+			mHash ^= ZobristHash::getSegmentKey(cell, towardsTail);
+			cell = board.neighbours[static_cast<std::size_t>(cell)][towardsTail];
+		}
+	}
+	mTail = static_cast<std::uint8_t>(cell);
+	mHash ^= ZobristHash::getSegmentKey(cell, ZobristHash::mTailSegment);
+	mLength = static_cast<std::uint16_t>(length);
+}
+
+auto BitboardState::move(const Board& board, const Snake::Direction direction) -> MoveResult
+{
+	const auto directionIndex{ static_cast<std::uint8_t>(direction) };
+	const std::int32_t newHead{ board.neighbours[mHead][directionIndex] };
+	const bool ateSnack{ newHead == mSnack };
+
+	// Trimming the tail first allows the head to move into the cell the tail leaves, like in Snake::move()
+	if (!ateSnack)
+	{
+		const std::uint8_t lastDirection{ getChainDirection(mLength - 2) };
+		const std::int32_t newTail{ board.neighbours[mTail][getOpposite(lastDirection)] };
+		setOccupied(mTail, false);
+		mHash ^= ZobristHash::getSegmentKey(mTail, ZobristHash::mTailSegment)
+			^ ZobristHash::getSegmentKey(newTail, lastDirection)
+			^ ZobristHash::getSegmentKey(newTail, ZobristHash::mTailSegment);
+		mTail = static_cast<std::uint8_t>(newTail);
+		--mLength;
+	}
+
+	if (isOccupied(newHead))
+	{
+		return MoveResult::DIED;
+	}
+
+	mChainStart = static_cast<std::uint16_t>((mChainStart + mMaxCells - 1) % mMaxCells);
+	setChainDirection(0, getOpposite(directionIndex));
+	mHash ^= ZobristHash::getSegmentKey(newHead, getOpposite(directionIndex));
+	setOccupied(newHead, true);
+	mHead = static_cast<std::uint8_t>(newHead);
+	++mLength;
+
+	if (ateSnack)
+	{
+		mHash ^= ZobristHash::getSnackKey(mSnack);
+		mSnack = mNoSnack;
+		return MoveResult::ATE_SNACK;
+	}
+	return MoveResult::MOVED;
+}
+
+auto BitboardState::placeSnack(const std::int32_t cell) -> void
+{
+	mSnack = static_cast<std::int16_t>(cell);
+	mHash ^= ZobristHash::getSnackKey(cell);
+}
+
+auto BitboardState::isOccupied(const std::int32_t cell) const -> bool
+{
+	return (mOccupied[static_cast<std::size_t>(cell / 64)] >> (cell % 64)) & 1;
+}
+
+auto BitboardState::hasSnack() const -> bool
+{
+	return mSnack != mNoSnack;
+}
+
+auto BitboardState::getHash() const -> std::uint64_t
+{
+	return mHash;
+}
+
+auto BitboardState::getLength() const -> std::int32_t
+{
+	return mLength;
+}
+
+auto BitboardState::getBlockedDirection() const -> Snake::Direction
+{
+	return static_cast<Snake::Direction>(getChainDirection(0));
+}
+
+auto BitboardState::getChainDirection(const std::int32_t index) const -> std::uint8_t
+{
+	const auto chainIndex{ static_cast<std::size_t>((mChainStart + index) % mMaxCells) };
+	return static_cast<std::uint8_t>((mChain[chainIndex / 32] >> (chainIndex % 32 * 2)) & 0b11);
+}
+
+auto BitboardState::setChainDirection(const std::int32_t index, const std::uint8_t direction) -> void
+{
+	const auto chainIndex{ static_cast<std::size_t>((mChainStart + index) % mMaxCells) };
+	auto& chainWord{ mChain[chainIndex / 32] };
+	chainWord &= ~(std::uint64_t{ 0b11 } << (chainIndex % 32 * 2));
+	chainWord |= std::uint64_t{ direction } << (chainIndex % 32 * 2);
+}
+
+auto BitboardState::setOccupied(const std::int32_t cell, const bool isOccupied) -> void
+{
+	auto& occupiedWord{ mOccupied[static_cast<std::size_t>(cell / 64)] };
+	const std::uint64_t cellBit{ std::uint64_t{ 1 } << (cell % 64) };
+	occupiedWord = isOccupied ? occupiedWord | cellBit : occupiedWord & ~cellBit;
+}
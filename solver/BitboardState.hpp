@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Snake.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Compact game state of the solver for boards of up to 16x16 cells, following the rules of the Snake class.
+ * The body is stored as an occupancy bitboard plus a chain of 2 bit directions from each segment to the next one
+ * towards the tail. Copying a state is cheap, so the search copies states instead of undoing moves.
+ */
+class BitboardState
+{
+ public:
+	constexpr static std::int32_t mMaxCells{ 256 };
+	constexpr static std::int16_t mNoSnack{ -1 };
+
+	enum class MoveResult
+	{
+		MOVED, ATE_SNACK, DIED
+	};
+
+	/// Board geometry shared by all states, including the wrap around neighbourhood of every cell
+	struct Board
+	{
+		std::int32_t width;
+		std::int32_t height;
+		std::int32_t cells;
+		/// Neighbour cell of every cell in each Direction
+		std::vector<std::array<std::uint8_t, 4>> neighbours;
+
+		/// Takes the game frame dimension like passed to the Snake
+		explicit Board(const Snake::Point& gameFrameDimension);
+		auto toCell(const Snake::Point& point) const -> std::int32_t;
+	};
+
+ private:
+	std::array<std::uint64_t, mMaxCells / 64> mOccupied;
+	/// Circular list of directions starting with the one of the head, mLength - 1 entries are valid
+	std::array<std::uint64_t, mMaxCells * 2 / 64> mChain;
+	std::uint64_t mHash;
+	std::uint16_t mChainStart;
+	std::uint16_t mLength;
+	std::uint8_t mHead;
+	std::uint8_t mTail;
+	/// mNoSnack if the snack has yet to be placed
+	std::int16_t mSnack;
+
+ public:
+	/// Spawns the snake like the Snake class does. The snake has to be at least 2 segments long
+	BitboardState(const Board& board, const Snake::Point& start, Snake::Direction direction, std::int32_t length);
+
+	auto move(const Board& board, Snake::Direction direction) -> MoveResult;
+	auto placeSnack(std::int32_t cell) -> void;
+
+	auto isOccupied(std::int32_t cell) const -> bool;
+	auto hasSnack() const -> bool;
+	auto getHash() const -> std::uint64_t;
+	auto getLength() const -> std::int32_t;
+	/// The direction pointing into the neck, which the snake can't turn to
+	auto getBlockedDirection() const -> Snake::Direction;
+
+ private:
+	auto getChainDirection(std::int32_t index) const -> std::uint8_t;
+	auto setChainDirection(std::int32_t index, std::uint8_t direction) -> void;
+	auto setOccupied(std::int32_t cell, bool isOccupied) -> void;
+};
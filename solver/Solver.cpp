@@ -0,0 +1,232 @@
+#include "Solver.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+std::shared_ptr<spdlog::logger> const Solver::mConsoleLogger{ spdlog::stderr_color_mt("Solver") };
+
+Solver::Solver(const Snake::Point& gameFrameDimension, const Objective objective, const std::size_t tableSizeMegabytes)
+	: mGameFrameDimension(gameFrameDimension), mBoard(gameFrameDimension), mObjective(objective),
+	  mTable(tableSizeMegabytes), mIsStopped(false), mNodes(0)
+{
+}
+
+auto Solver::solve(const BitboardState& root, const std::int32_t maxDepth, const std::uint32_t threadCount) -> Result
+{
+	const auto startTime{ std::chrono::steady_clock::now() };
+	const std::int32_t depth{ std::clamp(maxDepth, 1, mMaxDepth) };
+	mIsStopped = false;
+	mNodes = 0;
+
+	std::int32_t value{ mDead };
+	{
+		// Helper threads only fill the transposition table, the result is taken from the main thread
+		std::vector<std::jthread> helpers{};
+		for (std::uint32_t id{ 1 }; id < threadCount; ++id)
+		{
+			helpers.emplace_back([this, &root, depth, id]
+			{
+			  SearchThread helper{ id, 0 };
+			  this->deepen(root, depth, helper);
+			  mNodes += helper.unreportedNodes;
+			});
+		}
+
+		SearchThread mainThread{ 0, 0 };
+		value = this->deepen(root, depth, mainThread);
+		mNodes += mainThread.unreportedNodes;
+		mIsStopped = true;
+	}
+
+	const std::chrono::duration<double> searchTime{ std::chrono::steady_clock::now() - startTime };
+	return { value, depth, mNodes, static_cast<double>(mNodes) / searchTime.count() };
+}
+
+auto Solver::exportPolicy() const -> Policy
+{
+	Policy policy{ mGameFrameDimension };
+	mTable.forEach([&policy](const std::uint64_t hash, const TranspositionTable::Entry& entry)
+	{
+	  // Bounds don't tell whether the stored move survives: Upper bounds only say no move is better, lower bounds only
+	  // that one move is good enough to cut off, maybe with the luck of a best case snack
+	  if (entry.bound != TranspositionTable::Bound::EXACT || entry.value == mDead)
+	  {
+		  return;
+	  }
+	  // A state can have a result of a deeper & a shallower search
+	  if (const auto existing{ policy.lookup(hash) }; !existing || existing->depth < entry.depth)
+	  {
+		  policy.insert(hash, { entry.move, entry.depth, entry.value });
+	  }
+	});
+	return policy;
+}
+
+auto Solver::deepen(const BitboardState& root, const std::int32_t maxDepth, SearchThread& thread) -> std::int32_t
+{
+	const auto startTime{ std::chrono::steady_clock::now() };
+	std::int32_t value{ mDead };
+	for (std::int32_t depth{ 1 }; depth <= maxDepth; ++depth)
+	{
+		const std::int32_t depthValue{ this->searchSnack(root, depth, mDead - 1, mBoard.cells + 1, thread) };
+		if (mIsStopped.load(std::memory_order_relaxed))
+		{
+			break;
+		}
+		value = depthValue;
+
+		if (thread.id == 0)
+		{
+			const std::chrono::duration<double> searchTime{ std::chrono::steady_clock::now() - startTime };
+			const auto nodes{ mNodes.load(std::memory_order_relaxed) };
+			mConsoleLogger->info("Depth {:d}: length {:d} after {:d} nodes ({:.0f} nodes/s)", depth, value, nodes,
+				static_cast<double>(nodes) / searchTime.count());
+		}
+	}
+	return value;
+}
+
+auto Solver::searchMove(const BitboardState& state, const std::int32_t depth, std::int32_t alpha, std::int32_t beta,
+	SearchThread& thread) -> std::int32_t
+{
+	this->countNode(thread);
+	if (depth == 0)
+	{
+		return state.getLength();
+	}
+
+	const std::int32_t alphaOriginal{ alpha };
+	std::uint32_t firstDirection{ thread.id };
+	if (const auto entry{ mTable.probe(state.getHash(), static_cast<std::uint8_t>(depth)) })
+	{
+		// Unlike in chess, deeper results can't be reused: Dying after more moves doesn't mean dying within depth moves
+		if (depth == entry->depth)
+		{
+			using
+			enum TranspositionTable::Bound;
+			if (entry->bound == EXACT)
+			{
+				return entry->value;
+			}
+			else if (entry->bound == LOWER)
+			{
+				alpha = std::max<std::int32_t>(alpha, entry->value);
+			}
+			else
+			{
+				beta = std::min<std::int32_t>(beta, entry->value);
+			}
+			if (beta <= alpha)
+			{
+				return entry->value;
+			}
+		}
+		// Trying the best move of a previous search first gives the most cutoffs
+		firstDirection = static_cast<std::uint32_t>(entry->move);
+	}
+
+	std::int32_t bestValue{ mDead - 1 };
+	Snake::Direction bestDirection{ Snake::Direction::NORTH };
+	for (std::uint32_t i{ 0 }; i < 4; ++i)
+	{
+		const auto direction{ static_cast<Snake::Direction>((firstDirection + i) % 4) };
+		if (direction == state.getBlockedDirection())
+		{
+			continue;
+		}
+
+		BitboardState child{ state };
+		std::int32_t value{ mDead };
+		switch (child.move(mBoard, direction))
+		{
+		case BitboardState::MoveResult::MOVED:
+			value = this->searchMove(child, depth - 1, alpha, beta, thread);
+			break;
+		case BitboardState::MoveResult::ATE_SNACK:
+			value = this->searchSnack(child, depth - 1, alpha, beta, thread);
+			break;
+		case BitboardState::MoveResult::DIED:
+			break;
+		}
+		if (mIsStopped.load(std::memory_order_relaxed))
+		{
+			return 0;
+		}
+
+		if (bestValue < value)
+		{
+			bestValue = value;
+			bestDirection = direction;
+		}
+		alpha = std::max(alpha, value);
+		if (beta <= alpha)
+		{
+			break;
+		}
+	}
+
+	using
+	enum TranspositionTable::Bound;
+	const auto bound{ bestValue <= alphaOriginal ? UPPER : (beta <= bestValue ? LOWER : EXACT) };
+	mTable.store(state.getHash(), { static_cast<std::int16_t>(bestValue), static_cast<std::uint8_t>(depth), bound,
+	                                bestDirection });
+	return bestValue;
+}
+
+auto Solver::searchSnack(const BitboardState& state, const std::int32_t depth, std::int32_t alpha, std::int32_t beta,
+	SearchThread& thread) -> std::int32_t
+{
+	this->countNode(thread);
+	if (depth == 0 || state.getLength() == mBoard.cells)
+	{
+		return state.getLength();
+	}
+
+	const bool isWorstCase{ mObjective == Objective::GUARANTEED_LENGTH };
+	std::int32_t bestValue{ isWorstCase ? mBoard.cells + 1 : mDead - 1 };
+	// Threads start on different cells to spread over the tree
+	const auto firstCell{ static_cast<std::int32_t>(thread.id * 7) };
+	for (std::int32_t i{ 0 }; i < mBoard.cells; ++i)
+	{
+		const std::int32_t cell{ (firstCell + i) % mBoard.cells };
+		if (state.isOccupied(cell))
+		{
+			continue;
+		}
+
+		BitboardState child{ state };
+		child.placeSnack(cell);
+		const std::int32_t value{ this->searchMove(child, depth, alpha, beta, thread) };
+		if (mIsStopped.load(std::memory_order_relaxed))
+		{
+			return 0;
+		}
+
+		if (isWorstCase)
+		{
+			bestValue = std::min(bestValue, value);
+			beta = std::min(beta, value);
+		}
+		else
+		{
+			bestValue = std::max(bestValue, value);
+			alpha = std::max(alpha, value);
+		}
+		if (beta <= alpha)
+		{
+			break;
+		}
+	}
+	return bestValue;
+}
+
+auto Solver::countNode(SearchThread& thread) -> void
+{
+	// Batching keeps the shared counter from becoming a contention point
+	if (++thread.unreportedNodes == 4096)
+	{
+		mNodes.fetch_add(thread.unreportedNodes, std::memory_order_relaxed);
+		thread.unreportedNodes = 0;
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "BitboardState.hpp"
+#include "TranspositionTable.hpp"
+#include "Policy.hpp"
+
+#include <atomic>
+
+/**
+ * Offline solver for small boards. Searches the game tree of snake moves & snack placements with alpha-beta
+ * pruning & iterative deepening. Multiple threads search the same tree in parallel, sharing their results through the
+ * transposition table (lazy SMP).
+ *
+ * The value of a state is the snake length reached after searching depth moves ahead, or mDead if the snake can't
+ * survive that long. With the GUARANTEED_LENGTH objective every snack spawns on the worst possible cell, so the value is
+ * guaranteed regardless of luck. BEST_CASE_LENGTH spawns snacks on the best cell & yields the maximum achievable length.
+ */
+class Solver
+{
+ public:
+	constexpr static std::int32_t mDead{ -1 };
+	constexpr static std::int32_t mMaxDepth{ 255 };
+
+	enum class Objective
+	{
+		GUARANTEED_LENGTH, BEST_CASE_LENGTH
+	};
+
+	struct Result
+	{
+		std::int32_t value;
+		std::int32_t depth;
+		std::uint64_t nodes;
+		double nodesPerSecond;
+	};
+
+ private:
+	/// Search statistics & settings of one thread
+	struct SearchThread
+	{
+		std::uint32_t id;
+		std::uint64_t unreportedNodes;
+	};
+
+	static const std::shared_ptr<spdlog::logger> mConsoleLogger;
+
+	Snake::Point mGameFrameDimension;
+	BitboardState::Board mBoard;
+	Objective mObjective;
+	TranspositionTable mTable;
+	std::atomic<bool> mIsStopped;
+	std::atomic<std::uint64_t> mNodes;
+
+ public:
+	Solver(const Snake::Point& gameFrameDimension, Objective objective, std::size_t tableSizeMegabytes);
+
+	/**
+	 * Searches the game starting with the given snake before the first snack spawned, deepening up to maxDepth moves
+	 *
+	 * @param threadCount Threads searching in parallel, at least one
+	 */
+	auto solve(const BitboardState& root, std::int32_t maxDepth, std::uint32_t threadCount) -> Result;
+
+	/// Collects the best moves of all states whose exact value says the snake survives from the transposition table
+	auto exportPolicy() const -> Policy;
+
+ private:
+	/// Iterative deepening from the root, returns the value of the deepest completed search
+	auto deepen(const BitboardState& root, std::int32_t maxDepth, SearchThread& thread) -> std::int32_t;
+	/// Node in which the snake chooses its direction
+	auto searchMove(const BitboardState& state, std::int32_t depth, std::int32_t alpha, std::int32_t beta,
+		SearchThread& thread) -> std::int32_t;
+	/// Node in which the snack spawns on a free cell
+	auto searchSnack(const BitboardState& state, std::int32_t depth, std::int32_t alpha, std::int32_t beta,
+		SearchThread& thread) -> std::int32_t;
+	auto countNode(SearchThread& thread) -> void;
+};
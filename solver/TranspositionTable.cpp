@@ -0,0 +1,67 @@
+#include "TranspositionTable.hpp"
+
+#include <algorithm>
+#include <bit>
+
+TranspositionTable::TranspositionTable(const std::size_t sizeMegabytes)
+	: mSlots(), mBucketMask(0)
+{
+	const std::size_t bucketCount{
+		std::bit_floor(std::max(sizeMegabytes * 1024 * 1024 / (mBucketSize * sizeof(Slot)), std::size_t{ 1 })) };
+	// Value initialization zeroes all slots, marking them as empty
+	mSlots = std::make_unique<Slot[]>(bucketCount * mBucketSize);
+	mBucketMask = (bucketCount - 1) * mBucketSize;
+}
+
+auto TranspositionTable::probe(const std::uint64_t key, const std::uint8_t depth) const -> std::optional<Entry>
+{
+	const Slot* bucket{ &mSlots[key * mBucketSize & mBucketMask] };
+	const auto deepest{ read(bucket[0], key) };
+	if (deepest && deepest->depth == depth)
+	{
+		return deepest;
+	}
+	const auto newest{ read(bucket[1], key) };
+	return newest ? newest : deepest;
+}
+
+auto TranspositionTable::store(const std::uint64_t key, const Entry& entry) -> void
+{
+	Slot* bucket{ &mSlots[key * mBucketSize & mBucketMask] };
+	const std::uint64_t deepestData{ bucket[0].data.load(std::memory_order_relaxed) };
+	// Torn or foreign entries are compared by their depth as well, only the key check is skipped
+	const bool isDeeper{ (deepestData & mValidBit) != 0 && entry.depth < unpack(deepestData).depth };
+	Slot& slot{ isDeeper ? bucket[1] : bucket[0] };
+
+	const std::uint64_t data{ pack(entry) };
+	slot.data.store(data, std::memory_order_relaxed);
+	slot.checkedKey.store(key ^ data, std::memory_order_relaxed);
+}
+
+auto TranspositionTable::read(const Slot& slot, const std::uint64_t key) -> std::optional<Entry>
+{
+	const std::uint64_t data{ slot.data.load(std::memory_order_relaxed) };
+	if ((data & mValidBit) == 0 || (slot.checkedKey.load(std::memory_order_relaxed) ^ data) != key)
+	{
+		return std::nullopt;
+	}
+	return unpack(data);
+}
+
+auto TranspositionTable::pack(const Entry& entry) -> std::uint64_t
+{
+	return static_cast<std::uint16_t>(entry.value)
+		| std::uint64_t{ entry.depth } << 16
+		| std::uint64_t{ static_cast<std::uint8_t>(entry.bound) } << 24
+		| std::uint64_t{ static_cast<std::uint8_t>(entry.move) } << 32
+		| mValidBit;
+}
+
+auto TranspositionTable::unpack(const std::uint64_t data) -> Entry
+{
+	return {
+		static_cast<std::int16_t>(data & 0xFFFF),
+		static_cast<std::uint8_t>((data >> 16) & 0xFF),
+		static_cast<TranspositionTable::Bound>((data >> 24) & 0xFF),
+		static_cast<Snake::Direction>((data >> 32) & 0xFF) };
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Snake.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+/**
+ * Lock free hash table of search results shared by all solver threads. Every slot stores the key XORed with the data
+ * next to the data itself, so a slot torn by concurrent writes fails the key check on probing instead of returning
+ * mixed up results.
+ *
+ * The slots are grouped into buckets of two: the first slot keeps the deepest result (depth-preferred), the second one
+ * always takes the newest result. Iterative deepening thereby keeps the result of the current depth next to deeper ones
+ * stored by other threads.
+ */
+class TranspositionTable
+{
+ public:
+	enum class Bound : std::uint8_t
+	{
+		EXACT, LOWER, UPPER
+	};
+
+	struct Entry
+	{
+		std::int16_t value;
+		std::uint8_t depth;
+		Bound bound;
+		Snake::Direction move;
+	};
+
+ private:
+	struct Slot
+	{
+		std::atomic<std::uint64_t> checkedKey{};
+		std::atomic<std::uint64_t> data{};
+	};
+
+	/// Marks used slots, an all zero data word is an empty slot
+	constexpr static std::uint64_t mValidBit{ std::uint64_t{ 1 } << 40 };
+
+	constexpr static std::size_t mBucketSize{ 2 };
+
+	std::unique_ptr<Slot[]> mSlots;
+	/// Masks the key to the first slot of its bucket
+	std::size_t mBucketMask;
+
+ public:
+	/// The size is rounded down to a power of two number of buckets
+	explicit TranspositionTable(std::size_t sizeMegabytes);
+
+	/// Prefers the result of the state searched exactly depth moves ahead. Otherwise returns any other result of it,
+	/// whose move is still a good first guess
+	auto probe(std::uint64_t key, std::uint8_t depth) const -> std::optional<Entry>;
+	/// Goes into the depth-preferred slot unless it holds a deeper result, otherwise into the always replaced slot
+	auto store(std::uint64_t key, const Entry& entry) -> void;
+
+	/// Calls function(key, entry) for every entry, must not run concurrently to store(). A state might have two entries
+	template<typename Function>
+	auto forEach(Function&& function) const -> void;
+
+ private:
+	/// The entry of the state in the slot, if the slot holds it
+	static auto read(const Slot& slot, std::uint64_t key) -> std::optional<Entry>;
+	static auto pack(const Entry& entry) -> std::uint64_t;
+	static auto unpack(std::uint64_t data) -> Entry;
+};
+
+template<typename Function>
+auto TranspositionTable::forEach(Function&& function) const -> void
+{
+	for (std::size_t i{ 0 }; i < mBucketMask + mBucketSize; ++i)
+	{
+		const std::uint64_t data{ mSlots[i].data.load(std::memory_order_relaxed) };
+		if (data & mValidBit)
+		{
+			function(mSlots[i].checkedKey.load(std::memory_order_relaxed) ^ data, unpack(data));
+		}
+	}
+}
@@ -0,0 +1,115 @@
+#include "Solver.hpp"
+
+#include <fmt/core.h>
+
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+	auto printUsage() -> void
+	{
+		fmt::print(stderr, "Usage: snake_solver [options]\n"
+		                   "  --dimension <x> <y>   Game frame dimension like the game uses it, default 3 3 (a 4x4 board)\n"
+		                   "  --length <n>          Initial snake length, default 2\n"
+		                   "  --depth <n>           Number of moves to search ahead, default 12\n"
+		                   "  --threads <n>         Search threads, defaults to the number of cores\n"
+		                   "  --hash <megabytes>    Size of the transposition table, default 256\n"
+		                   "  --best-case           Maximum achievable length instead of the guaranteed one\n"
+		                   "  --policy <file>       Writes the found moves to a policy file for the games autopilot\n");
+	}
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+	Snake::Point gameFrameDimension{ 3, 3 };
+	std::int32_t length{ 2 };
+	std::int32_t depth{ 12 };
+	std::uint32_t threadCount{ std::max(std::thread::hardware_concurrency(), 1U) };
+	std::size_t tableSize{ 256 };
+	Solver::Objective objective{ Solver::Objective::GUARANTEED_LENGTH };
+	std::string policyPath{};
+
+	try
+	{
+		for (int i{ 1 }; i < argc; ++i)
+		{
+			const std::string_view argument{ argv[i] };
+			const auto nextValue{ [&]
+			{
+			  if (++i == argc)
+			  {
+				  throw std::invalid_argument{ "missing value" };
+			  }
+			  return std::string{ argv[i] };
+			} };
+
+			if (argument == "--dimension")
+			{
+				gameFrameDimension.first = std::stoi(nextValue());
+				gameFrameDimension.second = std::stoi(nextValue());
+			}
+			else if (argument == "--length")
+			{
+				length = std::stoi(nextValue());
+			}
+			else if (argument == "--depth")
+			{
+				depth = std::stoi(nextValue());
+			}
+			else if (argument == "--threads")
+			{
+				threadCount = static_cast<std::uint32_t>(std::stoul(nextValue()));
+			}
+			else if (argument == "--hash")
+			{
+				tableSize = std::stoul(nextValue());
+			}
+			else if (argument == "--best-case")
+			{
+				objective = Solver::Objective::BEST_CASE_LENGTH;
+			}
+			else if (argument == "--policy")
+			{
+				policyPath = nextValue();
+			}
+			else
+			{
+				throw std::invalid_argument{ "unknown option" };
+			}
+		}
+	}
+	catch (const std::logic_error&)
+	{
+		printUsage();
+		return EXIT_FAILURE;
+	}
+
+	try
+	{
+		Solver solver{ gameFrameDimension, objective, tableSize };
+		// Spawning the snake like the game does
+		const BitboardState::Board board{ gameFrameDimension };
+		const BitboardState root{ board, { gameFrameDimension.first / 2, gameFrameDimension.second / 2 },
+		                          Snake::Direction::EAST, length };
+
+		const Solver::Result result{ solver.solve(root, depth, std::max(threadCount, 1U)) };
+		fmt::print("{} length after {:d} moves: {:d}\n{:d} nodes, {:.0f} nodes/s\n",
+			objective == Solver::Objective::GUARANTEED_LENGTH ? "Guaranteed" : "Best case", result.depth, result.value,
+			result.nodes, result.nodesPerSecond);
+
+		if (!policyPath.empty())
+		{
+			const Policy policy{ solver.exportPolicy() };
+			policy.save(policyPath);
+			fmt::print("Wrote {:d} moves to {}\n", policy.getSize(), policyPath);
+		}
+	}
+	catch (const std::runtime_error& error)
+	{
+		fmt::print(stderr, "Solving failed: {}\n", error.what());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
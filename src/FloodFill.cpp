@@ -0,0 +1,323 @@
+#include "FloodFill.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+	/// Shared by all topologies, the logger name can only be registered once
+	auto getFloodFillLogger() -> const std::shared_ptr<spdlog::logger>&
+	{
+		static const std::shared_ptr<spdlog::logger> logger{ spdlog::stderr_color_mt("Flood Fill") };
+		return logger;
+	}
+}
+
+template<typename Topology>
+std::shared_ptr<spdlog::logger> const BasicFloodFill<Topology>::mConsoleLogger{ getFloodFillLogger() };
+
+template<typename Topology>
+BasicFloodFill<Topology>::BasicFloodFill(const Snake::Point& gameFrameDimension)
+	: mWidth(gameFrameDimension.first + 1), mHeight(gameFrameDimension.second + 1), mWordsPerRow(0),
+	  mLastWordMask(0), mFree(), mReached(), mReachedCells(0), mIsRowDirty(), mRowBuffer(), mEmptyRow(),
+	  mSavedFreeWords()
+{
+	if (mWidth < 1 || mHeight < 1)
+	{
+		mConsoleLogger->error("The game frame size ({:d},{:d}) is invalid", gameFrameDimension.first,
+			gameFrameDimension.second);
+		throw std::runtime_error{ "game frame size out of range" };
+	}
+
+	const auto width{ static_cast<std::size_t>(mWidth) };
+	mWordsPerRow = (width + 63) / 64;
+	mLastWordMask = width % 64 == 0 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << width % 64) - 1;
+
+	const std::size_t words{ mWordsPerRow * static_cast<std::size_t>(mHeight) };
+	mFree.assign(words, ~std::uint64_t{ 0 });
+	for (std::size_t lastWord{ mWordsPerRow - 1 }; lastWord < words; lastWord += mWordsPerRow)
+	{
+		mFree[lastWord] = mLastWordMask;
+	}
+	mReached.assign(words, 0);
+	mIsRowDirty.assign(static_cast<std::size_t>(mHeight), false);
+	mRowBuffer.assign(mWordsPerRow, 0);
+	mEmptyRow.assign(mWordsPerRow, 0);
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::setBlocked(const Snake::Point& point, const bool isBlocked) -> void
+{
+	if (isBlocked)
+	{
+		mFree[this->getWordIndex(point)] &= ~getBit(point);
+	}
+	else
+	{
+		mFree[this->getWordIndex(point)] |= getBit(point);
+	}
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::analyse(const std::deque<Snake::Point>& body) -> Result
+{
+	// Unblocking the body afterwards would free obstacles below it, so the words are restored instead
+	mSavedFreeWords.clear();
+	for (const auto& point: body)
+	{
+		const std::size_t wordIndex{ this->getWordIndex(point) };
+		mSavedFreeWords.emplace_back(wordIndex, mFree[wordIndex]);
+		mFree[wordIndex] &= ~getBit(point);
+	}
+
+	this->clearReached();
+	const Snake::Point& head{ body.front() };
+	this->forEachNeighbour(head, [this](const Snake::Point& neighbour)
+	{
+	  this->seed(neighbour);
+	});
+	this->propagate();
+
+	Result result{ mReachedCells, false };
+	this->forEachNeighbour(body.back(), [&](const Snake::Point& point)
+	{
+	  result.isTailReachable |= point == head || this->isReached(point);
+	});
+
+	// Backwards, so words holding several body points end up with the value saved first
+	for (auto savedWord{ mSavedFreeWords.crbegin() }; savedWord != mSavedFreeWords.crend(); ++savedWord)
+	{
+		mFree[savedWord->first] = savedWord->second;
+	}
+	return result;
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::fill(const Snake::Point& start) -> std::size_t
+{
+	this->clearReached();
+	if (this->seed(start))
+	{
+		this->propagate();
+	}
+	return mReachedCells;
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::getRegionSizes() -> std::vector<std::size_t>
+{
+	this->clearReached();
+	std::vector<std::size_t> regionSizes{};
+
+	for (std::size_t word{ 0 }; word < mFree.size(); ++word)
+	{
+		while (const std::uint64_t unreached{ mFree[word] & ~mReached[word] })
+		{
+			const std::size_t reachedBefore{ mReachedCells };
+			const auto column{ word % mWordsPerRow * 64 + static_cast<std::size_t>(std::countr_zero(unreached)) };
+			this->seed({ static_cast<std::int32_t>(column), static_cast<std::int32_t>(word / mWordsPerRow) });
+			this->propagate();
+			regionSizes.push_back(mReachedCells - reachedBefore);
+		}
+	}
+	return regionSizes;
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::isReached(const Snake::Point& point) const -> bool
+{
+	return (mReached[this->getWordIndex(point)] & getBit(point)) != 0;
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::clearReached() -> void
+{
+	std::ranges::fill(mReached, 0);
+	mReachedCells = 0;
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::seed(const Snake::Point& point) -> bool
+{
+	const std::size_t wordIndex{ this->getWordIndex(point) };
+	const std::uint64_t bit{ getBit(point) };
+	if ((mFree[wordIndex] & bit) == 0)
+	{
+		return false;
+	}
+	if ((mReached[wordIndex] & bit) == 0)
+	{
+		mReached[wordIndex] |= bit;
+		++mReachedCells;
+	}
+
+	// The seeded row has to spread horizontally & its neighbours vertically, even if the row itself doesn't change
+	const auto row{ static_cast<std::size_t>(point.second) };
+	const auto height{ static_cast<std::size_t>(mHeight) };
+	mIsRowDirty[(row + height - 1) % height] = true;
+	mIsRowDirty[row] = true;
+	mIsRowDirty[(row + 1) % height] = true;
+	return true;
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::propagate() -> void
+{
+	const auto height{ static_cast<std::size_t>(mHeight) };
+	const auto sweepRow{ [&](const std::size_t row)
+	{
+	  if (!mIsRowDirty[row])
+	  {
+		  return false;
+	  }
+	  mIsRowDirty[row] = false;
+	  if (!this->updateRow(static_cast<std::int32_t>(row)))
+	  {
+		  return false;
+	  }
+	  mIsRowDirty[(row + height - 1) % height] = true;
+	  mIsRowDirty[(row + 1) % height] = true;
+	  return true;
+	} };
+
+	// Alternating the direction lets cells travel along the whole board in a single sweep, no matter where they start
+	bool isChanging{ true };
+	while (isChanging)
+	{
+		isChanging = false;
+		for (std::size_t row{ 0 }; row < height; ++row)
+		{
+			isChanging |= sweepRow(row);
+		}
+		for (std::size_t row{ height }; row-- > 0;)
+		{
+			isChanging |= sweepRow(row);
+		}
+	}
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::updateRow(const std::int32_t row) -> bool
+{
+	const auto rowOffset{ [&](const std::int32_t otherRow)
+	{
+	  return static_cast<std::size_t>((otherRow + mHeight) % mHeight) * mWordsPerRow;
+	} };
+	// Nothing is reached beyond a solid border
+	const auto neighbourRow{ [&](const std::int32_t otherRow)
+	{
+	  if (Topology::mIsCrashingAtBorder && (otherRow < 0 || mHeight <= otherRow))
+	  {
+		  return mEmptyRow.data();
+	  }
+	  return mReached.data() + rowOffset(otherRow);
+	} };
+	std::uint64_t* reachedRow{ mReached.data() + rowOffset(row) };
+	const std::uint64_t* reachedAbove{ neighbourRow(row - 1) };
+	const std::uint64_t* reachedBelow{ neighbourRow(row + 1) };
+	const std::uint64_t* freeRow{ mFree.data() + rowOffset(row) };
+
+	// Plain loop the compiler vectorises for wide boards, boards up to 64 cells wide only have a single word per row
+	for (std::size_t i{ 0 }; i < mWordsPerRow; ++i)
+	{
+		mRowBuffer[i] = (reachedRow[i] | reachedAbove[i] | reachedBelow[i]) & freeRow[i];
+	}
+	this->fillRow(mRowBuffer.data(), freeRow);
+
+	std::size_t gainedCells{ 0 };
+	for (std::size_t i{ 0 }; i < mWordsPerRow; ++i)
+	{
+		gainedCells += static_cast<std::size_t>(std::popcount(mRowBuffer[i] & ~reachedRow[i]));
+	}
+	if (gainedCells == 0)
+	{
+		return false;
+	}
+	std::ranges::copy(mRowBuffer, reachedRow);
+	mReachedCells += gainedCells;
+	return true;
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::fillRow(std::uint64_t* reachedRow, const std::uint64_t* freeRow) const -> void
+{
+	const std::size_t lastWord{ mWordsPerRow - 1 };
+	const std::uint64_t lastBit{ std::uint64_t{ 1 } << static_cast<std::size_t>(mWidth - 1) % 64 };
+
+	// Adding the reached cells to the free runs carries up to the end of each run, the bits flipped by the carry are reached
+	const auto fillUpwards{ [&]
+	{
+	  bool isCarrying{ false };
+	  for (std::size_t i{ 0 }; i <= lastWord; ++i)
+	  {
+		  std::uint64_t& reached{ reachedRow[i] };
+		  reached |= isCarrying ? freeRow[i] & 1 : 0;
+		  reached |= ((reached + freeRow[i]) ^ freeRow[i]) & freeRow[i];
+		  isCarrying = (reached >> 63) != 0;
+	  }
+	} };
+	// Carries only run upwards, so this direction is an occluded fill doubling the shift distance every step
+	const auto fillDownwards{ [&]
+	{
+	  bool isCarrying{ false };
+	  for (std::size_t i{ lastWord + 1 }; i-- > 0;)
+	  {
+		  std::uint64_t reached{ reachedRow[i] | (isCarrying ? freeRow[i] & std::uint64_t{ 1 } << 63 : 0) };
+		  std::uint64_t propagator{ freeRow[i] };
+		  for (std::size_t shift{ 1 }; shift < 64; shift *= 2)
+		  {
+			  reached |= propagator & (reached >> shift);
+			  propagator &= propagator >> shift;
+		  }
+		  reachedRow[i] = reached;
+		  isCarrying = (reached & 1) != 0;
+	  }
+	} };
+
+	// Runs crossing a wrapping border continue on the other side, which needs a second pass in the same direction
+	fillUpwards();
+	if (!Topology::mIsCrashingAtBorder && (reachedRow[lastWord] & lastBit) != 0
+		&& (freeRow[0] & ~reachedRow[0] & 1) != 0)
+	{
+		reachedRow[0] |= 1;
+		fillUpwards();
+	}
+	fillDownwards();
+	if (!Topology::mIsCrashingAtBorder && (reachedRow[0] & 1) != 0
+		&& (freeRow[lastWord] & ~reachedRow[lastWord] & lastBit) != 0)
+	{
+		reachedRow[lastWord] |= lastBit;
+		fillDownwards();
+	}
+}
+
+template<typename Topology>
+template<typename Function>
+auto BasicFloodFill<Topology>::forEachNeighbour(const Snake::Point& point, Function&& function) const -> void
+{
+	const auto& [x, y] = point;
+	const Snake::Point gameFrameDimension{ mWidth - 1, mHeight - 1 };
+	for (Snake::Point neighbour: { Snake::Point{ x, y - 1 }, Snake::Point{ x + 1, y }, Snake::Point{ x, y + 1 },
+	                               Snake::Point{ x - 1, y }})
+	{
+		if (Topology::enterGameFrame(neighbour, gameFrameDimension))
+		{
+			function(neighbour);
+		}
+	}
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::getWordIndex(const Snake::Point& point) const -> std::size_t
+{
+	return static_cast<std::size_t>(point.second) * mWordsPerRow + static_cast<std::size_t>(point.first) / 64;
+}
+
+template<typename Topology>
+auto BasicFloodFill<Topology>::getBit(const Snake::Point& point) -> std::uint64_t
+{
+	return std::uint64_t{ 1 } << static_cast<std::size_t>(point.first) % 64;
+}
+
+template class BasicFloodFill<Rules::WrapAround>;
+template class BasicFloodFill<Rules::SolidBorder>;
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Snake.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Bitboard flood fill counting the free cells reachable from the snakes head, e.g. for autopilots & safety checks.
+ * Every board row is stored in 64 cell words.
+ *
+ * Rows are filled one after another: a row takes over the reached cells of the rows above & below, then the reached
+ * cells spread within the free runs of the row by carry propagation.
+ * Only rows next to changed rows are revisited, alternating top-down & bottom-up until nothing changes.
+ *
+ * @tparam Topology What happens at the game frame border like for the BasicSnake, Rules::WrapAround or
+ * Rules::SolidBorder. Only these two are instantiated at the end of FloodFill.cpp
+ */
+template<typename Topology = Rules::WrapAround>
+class BasicFloodFill
+{
+ public:
+	struct Result
+	{
+		/// Free cells reachable from the head, not counting the head itself
+		std::size_t reachableCells;
+		/// If the tail borders the reachable area, so the snake can follow its tail
+		bool isTailReachable;
+	};
+
+ private:
+	static const std::shared_ptr<spdlog::logger> mConsoleLogger;
+
+	std::int32_t mWidth;
+	std::int32_t mHeight;
+	std::size_t mWordsPerRow;
+	/// Bits of the last word of a row belonging to the board
+	std::uint64_t mLastWordMask;
+	std::vector<std::uint64_t> mFree;
+	std::vector<std::uint64_t> mReached;
+	std::size_t mReachedCells;
+	/// Rows which might gain reached cells from their neighbours
+	std::vector<std::uint8_t> mIsRowDirty;
+	std::vector<std::uint64_t> mRowBuffer;
+	/// Never reached row, merged in place of the rows beyond a solid border
+	std::vector<std::uint64_t> mEmptyRow;
+	/// Words of mFree overwritten by the body during analyse(), together with their index
+	std::vector<std::pair<std::size_t, std::uint64_t>> mSavedFreeWords;
+
+ public:
+	/// Creates a board of free cells with the game frame dimension like passed to the Snake
+	explicit BasicFloodFill(const Snake::Point& gameFrameDimension);
+
+	/// Blocked cells are never reached, e.g. obstacles
+	auto setBlocked(const Snake::Point& point, bool isBlocked) -> void;
+
+	/// Fills the board from the cells around the head, treating the body as blocked for the time of the call. Blocked
+	/// cells stay blocked, even if the body lies on them
+	auto analyse(const std::deque<Snake::Point>& body) -> Result;
+	/// Number of free cells reachable from the start point. The start point itself is counted if it is free
+	auto fill(const Snake::Point& start) -> std::size_t;
+	/// Sizes of all connected areas of free cells, ordered by their first cell row by row
+	auto getRegionSizes() -> std::vector<std::size_t>;
+	/// If the point was reached by the last fill
+	auto isReached(const Snake::Point& point) const -> bool;
+
+ private:
+	auto clearReached() -> void;
+	/// Marks the point as reached if it is free, returns false otherwise
+	auto seed(const Snake::Point& point) -> bool;
+	/// Spreads the reached cells until no row changes anymore
+	auto propagate() -> void;
+	/// Returns true if the row gained reached cells
+	auto updateRow(std::int32_t row) -> bool;
+	/// Spreads reached cells to the left & right within the free runs of a row, around the border if it wraps
+	auto fillRow(std::uint64_t* reachedRow, const std::uint64_t* freeRow) const -> void;
+	/// Calls the function with every neighbour of the point, brought into the game frame like the Topology says.
+	/// Neighbours behind a solid border are left out
+	template<typename Function>
+	auto forEachNeighbour(const Snake::Point& point, Function&& function) const -> void;
+	auto getWordIndex(const Snake::Point& point) const -> std::size_t;
+	static auto getBit(const Snake::Point& point) -> std::uint64_t;
+};
+
+/// The flood fill of the original rules, wrapping around the borders
+using FloodFill = BasicFloodFill<>;
+
+extern template class BasicFloodFill<Rules::WrapAround>;
+extern template class BasicFloodFill<Rules::SolidBorder>;
@@ -0,0 +1,190 @@
+#include "GameMap.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+std::shared_ptr<spdlog::logger> const GameMap::mConsoleLogger{ spdlog::stderr_color_mt("Game Map") };
+
+namespace
+{
+	static_assert(std::endian::native == std::endian::little, "Map files are read straight out of the memory mapping");
+
+	constexpr std::array<char, 8> mapMagic{ 'S', 'N', 'K', 'M', 'A', 'P', '0', '1' };
+
+	auto getWordsPerRow(const std::int32_t xDimension) -> std::size_t
+	{
+		return static_cast<std::size_t>(xDimension) / 64 + 1;
+	}
+}
+
+GameMap::GameMap()
+	: mMapping(nullptr), mMappingSize(0), mHeader(nullptr), mWalls(nullptr), mWordsPerRow(0)
+{
+}
+
+auto GameMap::load(const std::filesystem::path& path) -> GameMap
+{
+	const int fileDescriptor{ ::open(path.c_str(), O_RDONLY) };
+	struct stat fileStatus{};
+	if (fileDescriptor < 0 || ::fstat(fileDescriptor, &fileStatus) != 0
+		|| static_cast<std::size_t>(fileStatus.st_size) < sizeof(Header))
+	{
+		if (0 <= fileDescriptor)
+		{
+			::close(fileDescriptor);
+		}
+		mConsoleLogger->error("{} is no readable map file", path.string());
+		throw std::runtime_error{ "map file not readable" };
+	}
+
+	GameMap gameMap{};
+	gameMap.mMappingSize = static_cast<std::size_t>(fileStatus.st_size);
+	gameMap.mMapping = ::mmap(nullptr, gameMap.mMappingSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+	// The mapping stays valid without the file descriptor
+	::close(fileDescriptor);
+	if (gameMap.mMapping == MAP_FAILED)
+	{
+		gameMap.mMapping = nullptr;
+		mConsoleLogger->error("Can't map {} into memory: {}", path.string(), std::strerror(errno));
+		throw std::runtime_error{ "map file not mappable" };
+	}
+
+	gameMap.mHeader = static_cast<const Header*>(gameMap.mMapping);
+	gameMap.mWalls = reinterpret_cast<const std::uint64_t*>(gameMap.mHeader + 1);
+	const Header& header{ *gameMap.mHeader };
+	if (std::memcmp(header.magic, mapMagic.data(), mapMagic.size()) != 0)
+	{
+		mConsoleLogger->error("{} is no map file", path.string());
+		throw std::runtime_error{ "map file not readable" };
+	}
+
+	// Same limits as the Snake, which stores positions in 16 bits for rewinding
+	constexpr std::int32_t maximalDimension{ std::numeric_limits<std::int16_t>::max() };
+	if (header.xDimension < 0 || maximalDimension < header.xDimension || header.yDimension < 0
+		|| maximalDimension < header.yDimension || header.xSpawn < 0 || header.xDimension < header.xSpawn
+		|| header.ySpawn < 0 || header.yDimension < header.ySpawn || 3 < header.spawnDirection)
+	{
+		mConsoleLogger->error("Map {} has an invalid game frame ({:d},{:d}) or spawn ({:d},{:d}) {:d}", path.string(),
+			header.xDimension, header.yDimension, header.xSpawn, header.ySpawn, header.spawnDirection);
+		throw std::runtime_error{ "map file invalid" };
+	}
+
+	gameMap.mWordsPerRow = getWordsPerRow(header.xDimension);
+	const std::size_t wallBytes{
+		gameMap.mWordsPerRow * static_cast<std::size_t>(header.yDimension + 1) * sizeof(std::uint64_t) };
+	if (gameMap.mMappingSize != sizeof(Header) + wallBytes)
+	{
+		mConsoleLogger->error("Map {} has {:d} bytes instead of {:d}", path.string(), gameMap.mMappingSize,
+			sizeof(Header) + wallBytes);
+		throw std::runtime_error{ "map file truncated" };
+	}
+	if (gameMap.isWall(gameMap.getSpawn()))
+	{
+		mConsoleLogger->error("Map {} spawns the snake in a wall", path.string());
+		throw std::runtime_error{ "map file invalid" };
+	}
+
+	mConsoleLogger->info("Mapped ({:d},{:d}) map from {}", header.xDimension, header.yDimension, path.string());
+	return gameMap;
+}
+
+auto GameMap::save(const std::filesystem::path& path, const Point& gameFrameDimension, const Point& spawn,
+	const std::uint32_t spawnDirection, const std::vector<Point>& walls) -> void
+{
+	const auto [xDimension, yDimension] = gameFrameDimension;
+	const std::size_t wordsPerRow{ getWordsPerRow(xDimension) };
+	std::vector<std::uint64_t> wallBitmap(wordsPerRow * static_cast<std::size_t>(yDimension + 1), 0);
+	for (const auto& [x, y]: walls)
+	{
+		if (x < 0 || xDimension < x || y < 0 || yDimension < y)
+		{
+			mConsoleLogger->error("The wall ({:d},{:d}) is out of the game frame size ({:d},{:d})", x, y, xDimension,
+				yDimension);
+			throw std::runtime_error{ "wall out of game frame range" };
+		}
+		wallBitmap[static_cast<std::size_t>(y) * wordsPerRow + static_cast<std::size_t>(x) / 64] |=
+			std::uint64_t{ 1 } << (static_cast<std::size_t>(x) % 64);
+	}
+
+	Header header{ {}, xDimension, yDimension, spawn.first, spawn.second, spawnDirection, 0 };
+	std::memcpy(header.magic, mapMagic.data(), mapMagic.size());
+
+	std::ofstream mapFile{ path, std::ios::binary };
+	mapFile.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+	mapFile.write(reinterpret_cast<const char*>(wallBitmap.data()),
+		static_cast<std::streamsize>(wallBitmap.size() * sizeof(std::uint64_t)));
+	if (!mapFile)
+	{
+		mConsoleLogger->error("Can't write map file {}", path.string());
+		throw std::runtime_error{ "map file not writable" };
+	}
+}
+
+GameMap::GameMap(GameMap&& gameMap) noexcept
+	: mMapping(std::exchange(gameMap.mMapping, nullptr)), mMappingSize(std::exchange(gameMap.mMappingSize, 0)),
+	  mHeader(std::exchange(gameMap.mHeader, nullptr)), mWalls(std::exchange(gameMap.mWalls, nullptr)),
+	  mWordsPerRow(std::exchange(gameMap.mWordsPerRow, 0))
+{
+}
+
+GameMap& GameMap::operator=(GameMap&& gameMap) noexcept
+{
+	if (this != &gameMap)
+	{
+		this->unmap();
+		mMapping = std::exchange(gameMap.mMapping, nullptr);
+		mMappingSize = std::exchange(gameMap.mMappingSize, 0);
+		mHeader = std::exchange(gameMap.mHeader, nullptr);
+		mWalls = std::exchange(gameMap.mWalls, nullptr);
+		mWordsPerRow = std::exchange(gameMap.mWordsPerRow, 0);
+	}
+	return *this;
+}
+
+GameMap::~GameMap()
+{
+	this->unmap();
+}
+
+auto GameMap::getGameFrameDimension() const -> Point
+{
+	return { mHeader->xDimension, mHeader->yDimension };
+}
+
+auto GameMap::getSpawn() const -> Point
+{
+	return { mHeader->xSpawn, mHeader->ySpawn };
+}
+
+auto GameMap::getSpawnDirection() const -> std::uint32_t
+{
+	return mHeader->spawnDirection;
+}
+
+auto GameMap::getWallCount() const -> std::size_t
+{
+	std::size_t wallCount{ 0 };
+	for (std::size_t i{ 0 }; i < mWordsPerRow * static_cast<std::size_t>(mHeader->yDimension + 1); ++i)
+	{
+		wallCount += static_cast<std::size_t>(std::popcount(mWalls[i]));
+	}
+	return wallCount;
+}
+
+auto GameMap::unmap() -> void
+{
+	if (mMapping != nullptr)
+	{
+		::munmap(mMapping, mMappingSize);
+		mMapping = nullptr;
+	}
+}
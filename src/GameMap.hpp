@@ -0,0 +1,79 @@
+#pragma once
+
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+/**
+ * Level layout with walls, read from a binary file which is memory mapped instead of parsed, so even huge maps load
+ * instantly & only the touched pages are ever read from disk. All values are stored little endian:
+ *
+ *     char[8]   magic "SNKMAP01"
+ *     int32     game frame dimension x & y, like passed to the Snake
+ *     int32     spawn point x & y of the snakes head
+ *     uint32    spawn direction, the value of a Snake::Direction
+ *     uint32    reserved, 0
+ *     uint64[]  wall bitmap, row by row with (x / 64 + 1) words per row, bit (x % 64) set for a wall
+ *
+ * The bitmap starts at a multiple of 8 bytes, so the words are read right out of the mapping.
+ */
+class GameMap
+{
+ public:
+	/// Like Snake::Point
+	using Point = std::pair<std::int32_t, std::int32_t>;
+
+ private:
+	struct Header
+	{
+		char magic[8];
+		std::int32_t xDimension;
+		std::int32_t yDimension;
+		std::int32_t xSpawn;
+		std::int32_t ySpawn;
+		std::uint32_t spawnDirection;
+		std::uint32_t reserved;
+	};
+	static_assert(sizeof(Header) % sizeof(std::uint64_t) == 0, "The wall bitmap has to be aligned to its words");
+
+	static const std::shared_ptr<spdlog::logger> mConsoleLogger;
+
+	void* mMapping;
+	std::size_t mMappingSize;
+	const Header* mHeader;
+	const std::uint64_t* mWalls;
+	std::size_t mWordsPerRow;
+
+	GameMap();
+
+ public:
+	/// Maps the file into memory. Throws a std::runtime_error if it is no valid map file
+	static auto load(const std::filesystem::path& path) -> GameMap;
+	/// Writes a map file, the spawn direction is the value of a Snake::Direction
+	static auto save(const std::filesystem::path& path, const Point& gameFrameDimension, const Point& spawn,
+		std::uint32_t spawnDirection, const std::vector<Point>& walls) -> void;
+
+	GameMap(const GameMap&) = delete;
+	GameMap& operator=(const GameMap&) = delete;
+	GameMap(GameMap&& gameMap) noexcept;
+	GameMap& operator=(GameMap&& gameMap) noexcept;
+	~GameMap();
+
+	auto getGameFrameDimension() const -> Point;
+	auto getSpawn() const -> Point;
+	auto getSpawnDirection() const -> std::uint32_t;
+	/// The point has to be inside of the game frame. Inlined, as the snake checks its head against the walls every move
+	auto isWall(const Point& point) const -> bool
+	{
+		const auto [x, y] = point;
+		const std::uint64_t word{ mWalls[static_cast<std::size_t>(y) * mWordsPerRow + static_cast<std::size_t>(x) / 64] };
+		return (word >> (static_cast<std::size_t>(x) % 64) & 1) != 0;
+	}
+	auto getWallCount() const -> std::size_t;
+
+ private:
+	auto unmap() -> void;
+};
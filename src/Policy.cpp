@@ -0,0 +1,123 @@
+#include "Policy.hpp"
+
+#include <array>
+#include <fstream>
+
+std::shared_ptr<spdlog::logger> const Policy::mConsoleLogger{ spdlog::stderr_color_mt("Policy") };
+
+namespace
+{
+	constexpr std::array<char, 8> policyMagic{ 'S', 'N', 'K', 'P', 'L', 'C', 'Y', '1' };
+	/// Magic, game frame dimension & entry count
+	constexpr std::uintmax_t headerSize{ sizeof(policyMagic) + 2 * sizeof(std::int32_t) + sizeof(std::uint64_t) };
+	/// Hash, direction, depth & value
+	constexpr std::uintmax_t entrySize{ sizeof(std::uint64_t) + 2 * sizeof(std::uint8_t) + sizeof(std::int16_t) };
+
+	template<typename T>
+	auto writeValue(std::ofstream& file, const T& value) -> void
+	{
+		file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template<typename T>
+	auto readValue(std::ifstream& file) -> T
+	{
+		T value{};
+		file.read(reinterpret_cast<char*>(&value), sizeof(T));
+		return value;
+	}
+}
+
+Policy::Policy(const Snake::Point& gameFrameDimension)
+	: mGameFrameDimension(gameFrameDimension), mEntries()
+{
+}
+
+auto Policy::load(const std::filesystem::path& path) -> Policy
+{
+	std::ifstream policyFile{ path, std::ios::binary };
+	if (!policyFile || readValue<std::array<char, 8>>(policyFile) != policyMagic)
+	{
+		mConsoleLogger->error("{} is no readable policy file", path.string());
+		throw std::runtime_error{ "policy file not readable" };
+	}
+
+	const auto xDimension{ readValue<std::int32_t>(policyFile) };
+	const auto yDimension{ readValue<std::int32_t>(policyFile) };
+	Policy policy{{ xDimension, yDimension }};
+
+	// A corrupt count must not reserve more memory than the file can fill
+	const auto entryCount{ readValue<std::uint64_t>(policyFile) };
+	std::error_code errorCode{};
+	const std::uintmax_t fileSize{ std::filesystem::file_size(path, errorCode) };
+	if (!policyFile || errorCode || fileSize < headerSize || (fileSize - headerSize) / entrySize < entryCount)
+	{
+		mConsoleLogger->error("Policy file {} is truncated", path.string());
+		throw std::runtime_error{ "policy file truncated" };
+	}
+	policy.mEntries.reserve(static_cast<std::size_t>(entryCount));
+	for (std::uint64_t i{ 0 }; i < entryCount && policyFile; ++i)
+	{
+		const auto hash{ readValue<std::uint64_t>(policyFile) };
+		const auto direction{ static_cast<Snake::Direction>(readValue<std::uint8_t>(policyFile) % 4) };
+		const auto depth{ readValue<std::uint8_t>(policyFile) };
+		const auto value{ readValue<std::int16_t>(policyFile) };
+		policy.insert(hash, { direction, depth, value });
+	}
+
+	if (!policyFile)
+	{
+		mConsoleLogger->error("Policy file {} is truncated", path.string());
+		throw std::runtime_error{ "policy file truncated" };
+	}
+	mConsoleLogger->info("Loaded {:d} moves for a ({:d},{:d}) game frame from {}", policy.getSize(), xDimension, yDimension,
+		path.string());
+	return policy;
+}
+
+auto Policy::save(const std::filesystem::path& path) const -> void
+{
+	std::ofstream policyFile{ path, std::ios::binary };
+	writeValue(policyFile, policyMagic);
+	writeValue(policyFile, mGameFrameDimension.first);
+	writeValue(policyFile, mGameFrameDimension.second);
+	writeValue(policyFile, static_cast<std::uint64_t>(mEntries.size()));
+	for (const auto& [hash, entry]: mEntries)
+	{
+		writeValue(policyFile, hash);
+		writeValue(policyFile, static_cast<std::uint8_t>(entry.direction));
+		writeValue(policyFile, entry.depth);
+		writeValue(policyFile, entry.value);
+	}
+
+	if (!policyFile)
+	{
+		mConsoleLogger->error("Can't write policy file {}", path.string());
+		throw std::runtime_error{ "policy file not writable" };
+	}
+}
+
+auto Policy::insert(const std::uint64_t hash, const Entry& entry) -> void
+{
+	mEntries.insert_or_assign(hash, entry);
+}
+
+auto Policy::lookup(const std::uint64_t hash) const -> std::optional<Entry>
+{
+	const auto entry{ mEntries.find(hash) };
+	if (entry == mEntries.cend())
+	{
+		return std::nullopt;
+	}
+	return entry->second;
+}
+
+auto Policy::getGameFrameDimension() const -> const Snake::Point&
+{
+	return mGameFrameDimension;
+}
+
+auto Policy::getSize() const -> std::size_t
+{
+	return mEntries.size();
+}
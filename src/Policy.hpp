@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Snake.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <unordered_map>
+
+/**
+ * Moves computed by the offline solver, keyed by the ZobristHash of the game state. Used as the games autopilot & as
+ * ground truth for evaluating other players.
+ */
+class Policy
+{
+ public:
+	struct Entry
+	{
+		Snake::Direction direction;
+		/// Number of moves the solver searched ahead of this state
+		std::uint8_t depth;
+		/// Snake length guaranteed after depth moves, -1 if the snake can't survive that long
+		std::int16_t value;
+	};
+
+ private:
+	static const std::shared_ptr<spdlog::logger> mConsoleLogger;
+
+	Snake::Point mGameFrameDimension;
+	std::unordered_map<std::uint64_t, Entry> mEntries;
+
+ public:
+	explicit Policy(const Snake::Point& gameFrameDimension);
+
+	/// Throws a std::runtime_error if the file can't be read or isn't a policy file
+	static auto load(const std::filesystem::path& path) -> Policy;
+	auto save(const std::filesystem::path& path) const -> void;
+
+	auto insert(std::uint64_t hash, const Entry& entry) -> void;
+	auto lookup(std::uint64_t hash) const -> std::optional<Entry>;
+	auto getGameFrameDimension() const -> const Snake::Point&;
+	auto getSize() const -> std::size_t;
+};
@@ -0,0 +1,64 @@
+#include "RandomSource.hpp"
+
+namespace
+{
+	constexpr std::uint64_t goldenRatio{ 0x9E3779B97F4A7C15 };
+
+	/// SplitMix64 finalizer, a bijection so different counters never collide within a stream
+	constexpr auto mix(std::uint64_t value) -> std::uint64_t
+	{
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+		return value ^ (value >> 31);
+	}
+}
+
+auto RandomSource::nextBelow(const std::uint32_t bound) -> std::uint32_t
+{
+	// Lemire's method: the upper half of random * bound is in [0,bound). The few products whose lower half falls below
+	// 2^32 % bound are rejected, as they would make some results more likely than others
+	std::uint64_t product{ (this->next() >> 32) * bound };
+	auto lowerHalf{ static_cast<std::uint32_t>(product) };
+	if (lowerHalf < bound)
+	{
+		const std::uint32_t threshold{ static_cast<std::uint32_t>(-bound) % bound };
+		while (lowerHalf < threshold)
+		{
+			product = (this->next() >> 32) * bound;
+			lowerHalf = static_cast<std::uint32_t>(product);
+		}
+	}
+	return static_cast<std::uint32_t>(product >> 32);
+}
+
+auto RandomSource::nextInRange(const std::int32_t low, const std::int32_t high) -> std::int32_t
+{
+	const auto rangeSize{ static_cast<std::uint32_t>(static_cast<std::int64_t>(high) - low + 1) };
+	// The whole int32 range has 2^32 values, which wraps the size to 0. Every 32 bit value is in range then
+	if (rangeSize == 0)
+	{
+		return static_cast<std::int32_t>(static_cast<std::uint32_t>(this->next() >> 32));
+	}
+	return static_cast<std::int32_t>(static_cast<std::int64_t>(low) + this->nextBelow(rangeSize));
+}
+
+CounterRandomSource::CounterRandomSource(const std::uint64_t seed, const std::uint64_t streamId)
+	: mSeedKey(mix(seed + goldenRatio)), mStreamKey(mix(mSeedKey ^ mix(streamId + 2 * goldenRatio))), mPosition(0)
+{
+}
+
+auto CounterRandomSource::next() -> std::uint64_t
+{
+	const std::uint64_t counter{ ++mPosition * goldenRatio };
+	return mix(mix(counter ^ mStreamKey) + mSeedKey);
+}
+
+auto CounterRandomSource::getPosition() const -> std::uint64_t
+{
+	return mPosition;
+}
+
+auto CounterRandomSource::setPosition(const std::uint64_t position) -> void
+{
+	mPosition = position;
+}
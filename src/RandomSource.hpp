@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Source of random bits for everything random in a game, e.g. the snack placement. Satisfies the
+ * UniformRandomBitGenerator requirements, so it can also be passed to the standard library distributions.
+ */
+class RandomSource
+{
+ public:
+	using result_type = std::uint64_t;
+
+	virtual ~RandomSource() = default;
+
+	virtual auto next() -> std::uint64_t = 0;
+
+	/// Unbiased integer in [0,bound), bound has to be greater than 0
+	auto nextBelow(std::uint32_t bound) -> std::uint32_t;
+	/// Unbiased integer in the inclusive intervall [low,high]
+	auto nextInRange(std::int32_t low, std::int32_t high) -> std::int32_t;
+
+	constexpr static auto min() -> result_type
+	{
+		return 0;
+	}
+	constexpr static auto max() -> result_type
+	{
+		return ~result_type{ 0 };
+	}
+	auto operator()() -> result_type
+	{
+		return this->next();
+	}
+};
+
+/**
+ * Counter based generator: the n-th number is the counter n run through two SplitMix64 rounds keyed by the seed & the
+ * stream id, like Philox encrypts its counter. Every (seed, stream id) pair is an independent stream of 2^64 numbers,
+ * so every game can get its own stream without sharing state between threads. The state is three 64 bit words, 32 bytes
+ * together with the vtable pointer of the RandomSource interface.
+ */
+class CounterRandomSource final : public RandomSource
+{
+	std::uint64_t mSeedKey;
+	std::uint64_t mStreamKey;
+	std::uint64_t mPosition;
+
+ public:
+	CounterRandomSource(std::uint64_t seed, std::uint64_t streamId);
+
+	auto next() -> std::uint64_t override;
+
+	/// Number of values drawn so far
+	auto getPosition() const -> std::uint64_t;
+	/// Continues the stream from the given number of drawn values, e.g. to restore an earlier state
+	auto setPosition(std::uint64_t position) -> void;
+};
@@ -0,0 +1,121 @@
+#include "Replay.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+	const std::shared_ptr<spdlog::logger> consoleLogger{ spdlog::stderr_color_mt("Replay") };
+
+	auto toDirection(const char directionChar) -> Snake::Direction
+	{
+		switch (directionChar)
+		{
+			using
+			enum Snake::Direction;
+		case 'N':
+			return NORTH;
+		case 'E':
+			return EAST;
+		case 'S':
+			return SOUTH;
+		case 'W':
+			return WEST;
+		default:
+			consoleLogger->error("Unknown move '{}', expected one of N, E, S or W", directionChar);
+			throw std::runtime_error{ "unknown replay move" };
+		}
+	}
+}
+
+auto Replay::load(const std::filesystem::path& path) -> Replay
+{
+	std::ifstream replayFile{ path };
+	if (!replayFile)
+	{
+		consoleLogger->error("Can't open replay file {}", path.string());
+		throw std::runtime_error{ "replay file not readable" };
+	}
+
+	Replay replay{};
+	std::string line{};
+	for (std::size_t lineNumber{ 1 }; std::getline(replayFile, line); ++lineNumber)
+	{
+		std::istringstream lineStream{ line.substr(0, line.find('#')) };
+		std::string keyword{};
+		if (!(lineStream >> keyword))
+		{
+			continue; // Empty or comment line
+		}
+
+		bool isMalformed{ false };
+		if (keyword == "dimension")
+		{
+			isMalformed = !(lineStream >> replay.gameFrameDimension.first >> replay.gameFrameDimension.second);
+		}
+		else if (keyword == "snacks")
+		{
+			std::vector<std::int32_t> coordinates{};
+			std::int32_t coordinate{};
+			while (lineStream >> coordinate)
+			{
+				coordinates.push_back(coordinate);
+			}
+			isMalformed = coordinates.size() % 2 != 0;
+			for (std::size_t i{ 0 }; i + 1 < coordinates.size(); i += 2)
+			{
+				replay.snacks.emplace_back(coordinates[i], coordinates[i + 1]);
+			}
+		}
+		else if (keyword == "seed")
+		{
+			std::uint64_t seed{};
+			isMalformed = !(lineStream >> seed >> replay.gameId);
+			replay.seed = seed;
+		}
+		else if (keyword == "moves")
+		{
+			std::string moves{};
+			while (lineStream >> moves)
+			{
+				for (const char move: moves)
+				{
+					replay.moves.push_back(toDirection(move));
+				}
+			}
+		}
+		else
+		{
+			consoleLogger->error("Unknown keyword '{}' in line {:d} of {}", keyword, lineNumber, path.string());
+			throw std::runtime_error{ "unknown replay keyword" };
+		}
+
+		// Everything of a line has to be consumed
+		lineStream.clear();
+		if (isMalformed || !(lineStream >> std::ws).eof())
+		{
+			consoleLogger->error("Malformed line {:d} of {}: {}", lineNumber, path.string(), line);
+			throw std::runtime_error{ "malformed replay line" };
+		}
+	}
+
+	// Listed snacks would have been drawn from the stream as well, placing them first shifts all following snacks
+	if (replay.seed && !replay.snacks.empty())
+	{
+		consoleLogger->error("Replay {} contains both snacks & a seed", path.string());
+		throw std::runtime_error{ "replay contains snacks & a seed" };
+	}
+
+	consoleLogger->info("Loaded {} with {:d} moves & {:d} snacks", path.string(), replay.moves.size(), replay.snacks.size());
+	return replay;
+}
+
+ReplaySnacks::ReplaySnacks(const Replay& replay)
+	: mSnacks(replay.snacks), mNextSnack(0), mRandomSource()
+{
+	if (replay.seed)
+	{
+		mRandomSource.emplace(*replay.seed, replay.gameId);
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Snake.hpp"
+#include "RandomSource.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+/**
+ * A recorded game, loaded from a line based text file. Every line starts with a keyword, lines starting with '#' are comments:
+ *
+ *     dimension 14 14         # game frame dimension like passed to the Snake, defaults to (14,14)
+ *     snacks 3 4 10 7         # x y pairs of the snack positions in order of their appearance
+ *     moves EEENNNWWSS        # the direction the snake is turned to before each move, N/E/S/W
+ *     seed 1234 0             # seed & game id logged by the game, places the snacks instead of snacks lines
+ *
+ * snacks & moves lines may appear multiple times & are appended. A replay either lists its snacks or has a seed, as the
+ * game draws all of its snacks from the seeded stream. The snake spawns like in the game.
+ */
+struct Replay
+{
+	Snake::Point gameFrameDimension{ 14, 14 };
+	std::vector<Snake::Point> snacks;
+	std::vector<Snake::Direction> moves;
+	std::optional<std::uint64_t> seed;
+	std::uint64_t gameId{ 0 };
+
+	/// Throws a std::runtime_error if the file can't be read or contains unknown content
+	static auto load(const std::filesystem::path& path) -> Replay;
+};
+
+/**
+ * Places the snacks of a replay in the order the game placed them: the listed ones, or the ones the game drew from the
+ * random stream of its seed & game id. The latter depend on the snake, so it has to be replayed alongside.
+ */
+class ReplaySnacks
+{
+	std::vector<Snake::Point> mSnacks;
+	std::size_t mNextSnack;
+	std::optional<CounterRandomSource> mRandomSource;
+
+ public:
+	explicit ReplaySnacks(const Replay& replay);
+
+	/// The next snack for the snake in its current state, empty if the listed snacks ran out
+	template<typename SnakeType>
+	auto next(SnakeType& snake) -> std::optional<Snake::Point>
+	{
+		if (mRandomSource)
+		{
+			return snake.generateSnack(*mRandomSource);
+		}
+		if (mNextSnack < mSnacks.size())
+		{
+			return mSnacks[mNextSnack++];
+		}
+		return std::nullopt;
+	}
+};
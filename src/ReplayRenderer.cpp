@@ -0,0 +1,209 @@
+#include "ReplayRenderer.hpp"
+#include "SnakeGameFrame.hpp"
+
+#include <QPainter>
+#include <fmt/core.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+std::shared_ptr<spdlog::logger> const ReplayRenderer::mConsoleLogger{ spdlog::stderr_color_mt("Replay Renderer") };
+
+ReplayRenderer::ReplayRenderer(std::filesystem::path outputDirectory, const Format format, const std::int32_t framesPerMove,
+	RuleSet rules)
+	: mOutputDirectory(std::move(outputDirectory)), mFormat(format), mFramesPerMove(std::max(framesPerMove, 1)),
+	  mRules(std::move(rules))
+{
+}
+
+auto ReplayRenderer::render(const std::vector<std::filesystem::path>& replayPaths, const unsigned int threadCount) -> Result
+{
+	const auto startTime{ std::chrono::steady_clock::now() };
+	std::filesystem::create_directories(mOutputDirectory);
+
+	std::atomic<std::size_t> nextReplay{ 0 };
+	std::atomic<std::size_t> framesWritten{ 0 };
+	std::atomic<std::size_t> failedReplays{ 0 };
+	{
+		// Replays are taken one by one, so threads finishing short replays early pick up the remaining ones
+		std::vector<std::jthread> workers{};
+		for (unsigned int i{ 0 }; i < std::max(threadCount, 1U); ++i)
+		{
+			workers.emplace_back([&]
+			{
+			  for (std::size_t replay{ nextReplay++ }; replay < replayPaths.size(); replay = nextReplay++)
+			  {
+				  try
+				  {
+					  framesWritten += this->renderReplay(replayPaths[replay]);
+				  }
+				  catch (const std::exception& exception)
+				  {
+					  mConsoleLogger->error("Skipping replay {}: {}", replayPaths[replay].string(), exception.what());
+					  ++failedReplays;
+				  }
+			  }
+			});
+		}
+	}
+
+	return { framesWritten, failedReplays, std::chrono::steady_clock::now() - startTime };
+}
+
+auto ReplayRenderer::renderReplay(const std::filesystem::path& replayPath) -> std::size_t
+{
+	const Replay replay{ Replay::load(replayPath) };
+	if (replay.snacks.empty() && !replay.seed)
+	{
+		throw std::runtime_error{ "replay contains neither snacks nor a seed" };
+	}
+	if (mRules.getGameFrameDimension(replay.gameFrameDimension) != replay.gameFrameDimension)
+	{
+		throw std::runtime_error{ "replay dimension differs from the map" };
+	}
+
+	const QSize frameSize{ SnakeGameFrame::calculateGameFrameSize(replay.gameFrameDimension) };
+	QImage frame{ frameSize, QImage::Format_RGB32 };
+	QPainter painter{};
+	std::vector<char> rgbBuffer{};
+
+	const std::string replayName{ replayPath.stem().string() };
+	const std::filesystem::path frameDirectory{ mOutputDirectory / replayName };
+	const std::filesystem::path rawPath{ mOutputDirectory / (replayName + ".raw") };
+	std::ofstream rawStream{};
+	if (mFormat == Format::RAW)
+	{
+		rawStream.open(rawPath, std::ios::binary);
+		if (!rawStream)
+		{
+			throw std::runtime_error{ "can't open " + rawPath.string() };
+		}
+		mConsoleLogger->info("Writing {}x{} RGB frames of {}", frameSize.width(), frameSize.height(), replayName);
+	}
+	else
+	{
+		std::filesystem::create_directories(frameDirectory);
+	}
+
+	RuleSet::AnySnake snake{ mRules.createSnake(replay.gameFrameDimension) };
+	ReplaySnacks replaySnacks{ replay };
+	const auto nextSnack{ [&]
+	{
+	  return std::visit([&](auto& variant)
+	  {
+		return replaySnacks.next(variant);
+	  }, snake);
+	} };
+	Snake::Point snack{ *nextSnack() };
+
+	std::size_t frameCount{ 0 };
+	const auto writeFrame{ [&](const double tickProgress)
+	{
+	  frame.fill(Qt::GlobalColor::white);
+	  painter.begin(&frame);
+	  painter.setRenderHint(QPainter::Antialiasing);
+	  SnakeGameFrame::drawGame(painter, RuleSet::getBase(snake), snack, frameSize, tickProgress, mRules.gameMap.get());
+	  painter.end();
+
+	  switch (mFormat)
+	  {
+	  case Format::PNG:
+	  {
+		  const std::filesystem::path framePath{ frameDirectory / fmt::format("frame_{:06d}.png", frameCount) };
+		  if (!frame.save(QString::fromStdString(framePath.string()), "PNG"))
+		  {
+			  throw std::runtime_error{ "can't write " + framePath.string() };
+		  }
+		  break;
+	  }
+	  case Format::PPM:
+	  {
+		  ReplayRenderer::toRgb(frame, rgbBuffer);
+		  const std::filesystem::path framePath{ frameDirectory / fmt::format("frame_{:06d}.ppm", frameCount) };
+		  std::ofstream ppmFile{ framePath, std::ios::binary };
+		  ppmFile << fmt::format("P6\n{:d} {:d}\n255\n", frameSize.width(), frameSize.height());
+		  ppmFile.write(rgbBuffer.data(), static_cast<std::streamsize>(rgbBuffer.size()));
+		  // Closing flushes the frame, so a full disk shows up in the stream state
+		  ppmFile.close();
+		  if (!ppmFile)
+		  {
+			  throw std::runtime_error{ "can't write " + framePath.string() };
+		  }
+		  break;
+	  }
+	  case Format::RAW:
+	  {
+		  ReplayRenderer::toRgb(frame, rgbBuffer);
+		  if (!rawStream.write(rgbBuffer.data(), static_cast<std::streamsize>(rgbBuffer.size())))
+		  {
+			  throw std::runtime_error{ "can't write " + rawPath.string() };
+		  }
+		  break;
+	  }
+	  }
+	  ++frameCount;
+	} };
+
+	writeFrame(1);
+	for (const auto direction: replay.moves)
+	{
+		RuleSet::getBase(snake).turn(direction);
+		bool isOutOfSnacks{ false };
+		const bool ateSnack{ std::visit([&](auto& variant)
+		{
+		  return variant.move(snack);
+		}, snake) };
+		if (ateSnack)
+		{
+			const auto newSnack{ nextSnack() };
+			isOutOfSnacks = !newSnack;
+			snack = newSnack.value_or(snack);
+		}
+
+		for (std::int32_t subFrame{ 1 }; subFrame <= mFramesPerMove; ++subFrame)
+		{
+			writeFrame(static_cast<double>(subFrame) / mFramesPerMove);
+		}
+
+		if (std::visit([](auto& variant)
+		{
+		  return variant.isDead();
+		}, snake))
+		{
+			break;
+		}
+		else if (isOutOfSnacks)
+		{
+			mConsoleLogger->warn("Replay {} ran out of snacks", replayName);
+			break;
+		}
+	}
+
+	if (mFormat == Format::RAW)
+	{
+		rawStream.close();
+		if (!rawStream)
+		{
+			throw std::runtime_error{ "can't write " + rawPath.string() };
+		}
+	}
+	return frameCount;
+}
+
+auto ReplayRenderer::toRgb(const QImage& frame, std::vector<char>& buffer) -> void
+{
+	buffer.resize(static_cast<std::size_t>(frame.width() * frame.height() * 3));
+	auto rgbIterator{ buffer.begin() };
+	for (int y{ 0 }; y < frame.height(); ++y)
+	{
+		const auto* scanLine{ reinterpret_cast<const QRgb*>(frame.constScanLine(y)) };
+		for (int x{ 0 }; x < frame.width(); ++x)
+		{
+			*rgbIterator++ = static_cast<char>(qRed(scanLine[x]));
+			*rgbIterator++ = static_cast<char>(qGreen(scanLine[x]));
+			*rgbIterator++ = static_cast<char>(qBlue(scanLine[x]));
+		}
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Replay.hpp"
+
+#include <QImage>
+
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+/**
+ * Renders replays into image files without any window, using the same drawing logic as the SnakeGameFrame.
+ * Works with the "offscreen" Qt platform plugin. Replays are distributed over multiple threads, each replay is rendered
+ * into its own QImage.
+ */
+class ReplayRenderer
+{
+ public:
+	enum class Format
+	{
+		/// One PNG file per frame, slow but small
+		PNG,
+		/// One binary PPM (P6) file per frame
+		PPM,
+		/// All frames of a replay concatenated into one file of raw 8 bit RGB pixels, e.g. for piping into ffmpeg
+		RAW
+	};
+
+ private:
+	static const std::shared_ptr<spdlog::logger> mConsoleLogger;
+
+	std::filesystem::path mOutputDirectory;
+	Format mFormat;
+	/// Frames drawn per snake movement, values above 1 add interpolated frames like the game displays them
+	std::int32_t mFramesPerMove;
+	/// Rules the replays were played with, shared by all threads
+	RuleSet mRules;
+
+ public:
+	struct Result
+	{
+		std::size_t framesWritten;
+		/// Replays which couldn't be loaded or written
+		std::size_t failedReplays;
+		/// Wall clock time of the whole call
+		std::chrono::duration<double> renderTime;
+	};
+
+	/// Replays played on a map have to have the dimension of the map
+	ReplayRenderer(std::filesystem::path outputDirectory, Format format, std::int32_t framesPerMove = 1,
+		RuleSet rules = {});
+
+	/**
+	 * Renders every replay into a subdirectory (or a .raw file) of the output directory named like the replay file.
+	 * Replays which can't be loaded or written are logged, counted as failed & skipped.
+	 */
+	auto render(const std::vector<std::filesystem::path>& replayPaths, unsigned int threadCount) -> Result;
+
+ private:
+	auto renderReplay(const std::filesystem::path& replayPath) -> std::size_t;
+	/// Converts the frame to 8 bit RGB into the buffer, which is reused for every frame of a replay
+	static auto toRgb(const QImage& frame, std::vector<char>& buffer) -> void;
+};
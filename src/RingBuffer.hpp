@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+
+/**
+ * Fixed size LIFO ring buffer. Pushing into a full buffer overwrites the oldest element, so only the last
+ * getCapacity() elements are kept. The storage is allocated once on construction, pushing & popping is O(1) &
+ * allocation free.
+ */
+template<typename T>
+class RingBuffer
+{
+	std::unique_ptr<T[]> mElements;
+	std::size_t mCapacity;
+	/// Index the next element is pushed to
+	std::size_t mNext;
+	std::size_t mSize;
+
+ public:
+	explicit RingBuffer(std::size_t capacity)
+		: mElements(std::make_unique<T[]>(capacity)), mCapacity(capacity), mNext(0), mSize(0)
+	{
+		assert(capacity > 0);
+	}
+
+	auto push(const T& element) -> void
+	{
+		mElements[mNext] = element;
+		mNext = (mNext + 1) % mCapacity;
+		if (mSize < mCapacity)
+		{
+			++mSize;
+		}
+	}
+
+	/// Removes & returns the newest element, the buffer must not be empty
+	auto pop() -> T
+	{
+		assert(mSize > 0);
+		mNext = (mNext + mCapacity - 1) % mCapacity;
+		--mSize;
+		return mElements[mNext];
+	}
+
+	auto clear() -> void
+	{
+		mNext = 0;
+		mSize = 0;
+	}
+
+	auto isEmpty() const -> bool
+	{
+		return mSize == 0;
+	}
+
+	auto getSize() const -> std::size_t
+	{
+		return mSize;
+	}
+
+	auto getCapacity() const -> std::size_t
+	{
+		return mCapacity;
+	}
+};
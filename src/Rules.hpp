@@ -0,0 +1,100 @@
+#pragma once
+
+#include "GameMap.hpp"
+
+#include <memory>
+
+/**
+ * Rule variants of the game, passed as template parameters to the BasicSnake. They are resolved at compile time, so the
+ * default rules of a wrapping board without obstacles don't pay for the checks of the other variants on every move.
+ *
+ * Topology policies provide static enterGameFrame(point, gameFrameDimension), which brings a point that just left the
+ * game frame back in or returns false if the snake crashed into the border.
+ * Obstacle policies are stored in the snake & provide isBlocked(point) for points inside of the game frame.
+ */
+namespace Rules
+{
+	/// Like Snake::Point
+	using Point = std::pair<std::int32_t, std::int32_t>;
+
+	/// Leaving the game frame on one side enters it on the opposite one
+	struct WrapAround
+	{
+		constexpr static bool mIsCrashingAtBorder{ false };
+
+		constexpr static auto enterGameFrame(Point& point, const Point& gameFrameDimension) -> bool
+		{
+			auto& [x, y] = point;
+			auto& [xGameDimension, yGameDimension] = gameFrameDimension;
+
+			if (y < 0)
+			{
+				y += yGameDimension + 1;
+			}
+			else if (yGameDimension < y)
+			{
+				y -= yGameDimension + 1;
+			}
+			else if (x < 0)
+			{
+				x += xGameDimension + 1;
+			}
+			else if (xGameDimension < x)
+			{
+				x -= xGameDimension + 1;
+			}
+			return true;
+		}
+	};
+
+	/// The game frame is surrounded by a wall
+	struct SolidBorder
+	{
+		constexpr static bool mIsCrashingAtBorder{ true };
+
+		constexpr static auto enterGameFrame(const Point& point, const Point& gameFrameDimension) -> bool
+		{
+			const auto [x, y] = point;
+			return 0 <= x && x <= gameFrameDimension.first && 0 <= y && y <= gameFrameDimension.second;
+		}
+	};
+
+	/// Empty board, takes no space in the snake
+	struct NoObstacles
+	{
+		constexpr static bool mHasObstacles{ false };
+
+		/// Ignores the walls of the map, playing it with obstacles turned off
+		static auto fromMap(const std::shared_ptr<const GameMap>&) -> NoObstacles
+		{
+			return {};
+		}
+		constexpr auto isBlocked(const Point&) const -> bool
+		{
+			return false;
+		}
+	};
+
+	/// Walls of a map, which has to be shared as the snake can be moved & rewound independent of the level
+	class MapObstacles
+	{
+		std::shared_ptr<const GameMap> mGameMap;
+
+	 public:
+		constexpr static bool mHasObstacles{ true };
+
+		explicit MapObstacles(std::shared_ptr<const GameMap> gameMap)
+			: mGameMap(std::move(gameMap))
+		{
+		}
+
+		static auto fromMap(const std::shared_ptr<const GameMap>& gameMap) -> MapObstacles
+		{
+			return MapObstacles{ gameMap };
+		}
+		auto isBlocked(const Point& point) const -> bool
+		{
+			return mGameMap->isWall(point);
+		}
+	};
+}
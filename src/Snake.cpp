@@ -5,39 +5,28 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
-std::shared_ptr<spdlog::logger> const Snake::mConsoleLogger{ spdlog::stderr_color_mt("Snake") };
+std::shared_ptr<spdlog::logger> const SnakeBase::mConsoleLogger{ spdlog::stderr_color_mt("Snake") };
 
-auto Snake::changeToPlayFieldAwarePosition(Snake::Point& point) -> void
+SnakeBase::SnakeBase(const Point& gameFrameDimension, const Point& start, Direction direction,
+	const std::int32_t length, const std::int32_t speedUpCountDown, const std::size_t rewindCapacity)
+	: mGameFrameDimension(gameFrameDimension), mCurrentMovementSpeed(mInitialMovementSpeed),
+	  mCurrentSpeedUpCountDownStart(speedUpCountDown), mCurrentSpeedUpCountDown(speedUpCountDown), mLevel(1),
+	  mViewDirection(direction), mTailDirection(SnakeBase::getOpposite(direction)), mPreviousTail(start),
+	  mHistory(rewindCapacity), mHasCrashed(false)
 {
-	auto& [x, y] = point;
-	auto& [xGameDimension, yGameDimension] = mGameFrameDimension;
+	auto& [xStart, yStart] = start;
+	auto& [xGameDimension, yGameDimension] = gameFrameDimension;
 
-	if (y < 0)
-	{
-		y += yGameDimension + 1;
-	}
-	else if (yGameDimension < y)
+	// The rewind history stores snack positions compactly
+	if (std::numeric_limits<std::int16_t>::max() < std::max(xGameDimension, yGameDimension))
 	{
-		y -= yGameDimension + 1;
+		mConsoleLogger->error("The game frame size ({:d},{:d}) exceeds the maximum of {:d}",
+			xGameDimension, yGameDimension, std::numeric_limits<std::int16_t>::max());
+		throw std::runtime_error{ "game frame size out of range" };
 	}
-	else if (x < 0)
-	{
-		x += xGameDimension + 1;
-	}
-	else if (xGameDimension < x)
-	{
-		x -= xGameDimension + 1;
-	}
-}
-
-Snake::Snake(const Point& gameFrameDimension, const Point& start, Direction direction,
-	const std::int32_t length, const std::int32_t speedUpCountDown)
-	: mGameFrameDimension(gameFrameDimension), mCurrentMovementSpeed(3), mCurrentSpeedUpCountDownStart(speedUpCountDown), mLevel(1),
-	  mViewDirection(direction), mTailDirection(Snake::getOpposite(direction))
-{
-	auto& [xStart, yStart] = start;
-	auto& [xGameDimension, yGameDimension] = gameFrameDimension;
 
 	// Initialization outside of the game frame
 	if (xStart < 0 || xGameDimension < xStart)
@@ -61,8 +50,8 @@ Snake::Snake(const Point& gameFrameDimension, const Point& start, Direction dire
 	for (int i = 1; i < length; ++i)
 	{
 		// Makes the snake "grow" in the opposite direction of the initial view direction
-		auto [xNextModificator, yNextModificator] { Snake::getDirectionsRelativeCoords(
-			Snake::getOpposite(direction) // Snake body grows in opposite direction of viewing direction
+		auto [xNextModificator, yNextModificator] { SnakeBase::getDirectionsRelativeCoords(
+			SnakeBase::getOpposite(direction) // Snake body grows in opposite direction of viewing direction
 		) };
 		// buffer because operator+= & operator- not overwritten
 		xNext += xNextModificator;
@@ -71,61 +60,192 @@ Snake::Snake(const Point& gameFrameDimension, const Point& start, Direction dire
 	}
 
 	// Extreme case: The snake spawns on a snack & does not grow because the length updates happening in move() TODO
-	// Extreme case: Snake spawns around one game field edge
-	std::for_each(mBody.begin(), mBody.end(), [this](auto& bodyPoint)
+}
+
+template<typename Topology, typename Obstacles>
+BasicSnake<Topology, Obstacles>::BasicSnake(const Point& gameFrameDimension, const Point& start, Direction direction,
+	const std::int32_t length, const std::int32_t speedUpCountDown, const std::size_t rewindCapacity, Obstacles obstacles)
+	: SnakeBase(gameFrameDimension, start, direction, length, speedUpCountDown, rewindCapacity),
+	  mObstacles(std::move(obstacles))
+{
+	// Extreme case: Snake spawns around one game field edge, which is only allowed if the snake wraps around
+	for (auto& bodyPoint: mBody)
 	{
-	  Snake::changeToPlayFieldAwarePosition(bodyPoint);
-	});
+		if (!this->changeToPlayFieldAwarePosition(bodyPoint) || mObstacles.isBlocked(bodyPoint))
+		{
+			mConsoleLogger->error("The snake spawned on {} doesn't fit into the game frame, {} is blocked", start,
+				bodyPoint);
+			throw std::runtime_error{ "snake spawned in a wall" };
+		}
+	}
+	mPreviousTail = mBody.back();
 
 	// Logging
 	mConsoleLogger->info("Created from {:d},{:d} to {:d},{:d}:{}",
-		xStart, yStart, mBody.back().first, mBody.back().second, mBody);
+		start.first, start.second, mBody.back().first, mBody.back().second, mBody);
 }
 
-Snake::Snake(const Point& gameFrameDimension, Direction direction, std::int32_t length)
-	: Snake(gameFrameDimension, Point{ (gameFrameDimension.first) / 2, (gameFrameDimension.second) / 2 },
+template<typename Topology, typename Obstacles>
+BasicSnake<Topology, Obstacles>::BasicSnake(const Point& gameFrameDimension, const Direction direction,
+	const std::int32_t length)
+requires std::is_default_constructible_v<Obstacles>
+	: BasicSnake(gameFrameDimension, Point{ (gameFrameDimension.first) / 2, (gameFrameDimension.second) / 2 },
 	direction, length)
 {
 }
 
-auto Snake::move(const Point& snackPosition) -> bool
+template<typename Topology, typename Obstacles>
+auto BasicSnake<Topology, Obstacles>::fromMap(const std::shared_ptr<const GameMap>& gameMap,
+	const std::int32_t length) -> BasicSnake
+{
+	return BasicSnake{ gameMap->getGameFrameDimension(), gameMap->getSpawn(),
+	                   static_cast<Direction>(gameMap->getSpawnDirection()), length, mDefaultSpeedUpCountDown,
+	                   mDefaultRewindCapacity, Obstacles::fromMap(gameMap) };
+}
+
+template<typename Topology, typename Obstacles>
+auto BasicSnake<Topology, Obstacles>::changeToPlayFieldAwarePosition(Point& point) -> bool
+{
+	return Topology::enterGameFrame(point, mGameFrameDimension);
+}
+
+template<typename Topology, typename Obstacles>
+auto BasicSnake<Topology, Obstacles>::move(const Point& snackPosition) -> bool
 {
-	// Counts down on every eaten snack, if == 0 the snake levels up
-	static std::int32_t currentSpeedUpCountDown{ mCurrentSpeedUpCountDownStart };
+	TickDelta delta{
+		static_cast<std::int16_t>(snackPosition.first), static_cast<std::int16_t>(snackPosition.second),
+		static_cast<std::uint8_t>(mViewDirection), static_cast<std::uint8_t>(mTailDirection), 0, false, false };
 
 	const auto [xRelativeMoving, yRelativeMoving]{ getDirectionsRelativeCoords(mViewDirection) };
 	const auto [xCurrentHead, yCurrentHead] = mBody.front();
 	Point newHeadPosition{ xCurrentHead + xRelativeMoving, yCurrentHead + yRelativeMoving };
 
-	// Snake is moving about a border
-	changeToPlayFieldAwarePosition(newHeadPosition);
+	// Snake is moving about a border. Both checks are compiled out for the rules without walls
+	if (!changeToPlayFieldAwarePosition(newHeadPosition) || mObstacles.isBlocked(newHeadPosition))
+	{
+		mHasCrashed = true;
+		mPreviousTail = mBody.back();
+		mConsoleLogger->info("Crashed into a wall on {}", newHeadPosition);
+		return false;
+	}
 
 	mBody.push_front(newHeadPosition);
 
 	// Snake grows and maybe levels up if a snack is eaten, else the size stays the same.
+	mPreviousTail = mBody.back();
 	bool ateSnack{ false };
 	if (this->isOnSnack(snackPosition))
 	{
 		ateSnack = true;
+		delta.ateSnack = true;
 		mConsoleLogger->info("Ate snack on position {}. Adjusting size to {}", mBody.front(), this->getLength());
 		// Level up semantic
-		if (--currentSpeedUpCountDown == 0)
+		if (--mCurrentSpeedUpCountDown == 0)
 		{
-			currentSpeedUpCountDown = ++mCurrentSpeedUpCountDownStart;
+			mCurrentSpeedUpCountDown = ++mCurrentSpeedUpCountDownStart;
 			this->levelUp();
+			delta.leveledUp = true;
 		}
 	}
 	else
 	{
 		mBody.pop_back();
+		delta.trimmedTailDirection = static_cast<std::uint8_t>(getDirectionBetween(mBody.back(), mPreviousTail));
 	}
 
 	// The tail direction is set here to ensure the snake cant eat itself by turning 180°
 	mTailDirection = getOpposite(mViewDirection);
+	mHistory.push(delta);
 	return ateSnack;
 }
 
-auto Snake::turn(Direction direction) -> void
+template<typename Topology, typename Obstacles>
+auto BasicSnake<Topology, Obstacles>::stepBack(Point& snackPosition) -> bool
+{
+	// Crashing left the body untouched
+	if (mHasCrashed)
+	{
+		mHasCrashed = false;
+		return true;
+	}
+	if (mHistory.isEmpty())
+	{
+		return false;
+	}
+	const TickDelta delta{ mHistory.pop() };
+
+	mBody.pop_front();
+	if (delta.ateSnack)
+	{
+		snackPosition = { delta.eatenSnackX, delta.eatenSnackY };
+		if (delta.leveledUp)
+		{
+			this->levelDown();
+			mCurrentSpeedUpCountDown = 1;
+		}
+		else
+		{
+			++mCurrentSpeedUpCountDown;
+		}
+	}
+	else
+	{
+		const auto [xRelativeTrimmed, yRelativeTrimmed]{
+			getDirectionsRelativeCoords(static_cast<Direction>(delta.trimmedTailDirection)) };
+		Point trimmedTail{ mBody.back().first + xRelativeTrimmed, mBody.back().second + yRelativeTrimmed };
+		changeToPlayFieldAwarePosition(trimmedTail);
+		mBody.push_back(trimmedTail);
+	}
+
+	mViewDirection = static_cast<Direction>(delta.viewDirection);
+	mTailDirection = static_cast<Direction>(delta.tailDirection);
+	// Nothing to interpolate after rewinding
+	mPreviousTail = mBody.back();
+	return true;
+}
+
+template<typename Topology, typename Obstacles>
+auto BasicSnake<Topology, Obstacles>::canStepBack() -> bool
+{
+	return mHasCrashed || !mHistory.isEmpty();
+}
+
+template<typename Topology, typename Obstacles>
+auto BasicSnake<Topology, Obstacles>::isDead() -> bool
+{
+	if constexpr (Topology::mIsCrashingAtBorder || Obstacles::mHasObstacles)
+	{
+		if (mHasCrashed)
+		{
+			return true;
+		}
+	}
+	return this->isEatingItself();
+}
+
+template<typename Topology, typename Obstacles>
+auto BasicSnake<Topology, Obstacles>::generateSnack(RandomSource& randomSource) -> Point
+{
+	Point snack{};
+	do
+	{
+		snack = { randomSource.nextInRange(0, mGameFrameDimension.first),
+		          randomSource.nextInRange(0, mGameFrameDimension.second) };
+	}
+	while (this->isOnSnack(snack) || mObstacles.isBlocked(snack));
+
+	return snack;
+}
+
+template<typename Topology, typename Obstacles>
+BasicSnake<Topology, Obstacles>& BasicSnake<Topology, Obstacles>::operator=(BasicSnake&& snake) noexcept
+{
+	SnakeBase::operator=(std::move(snake));
+	mObstacles = std::move(snake.mObstacles);
+	return *this;
+}
+
+auto SnakeBase::turn(Direction direction) -> void
 {
 	//assert(direction != mViewDirection);
 	//assert(direction != static_cast<Direction>((directionAsInt + 2) % 4));
@@ -138,7 +258,7 @@ auto Snake::turn(Direction direction) -> void
 	}
 }
 
-auto Snake::isOnSnack(const Point& snackPosition) -> bool
+auto SnakeBase::isOnSnack(const Point& snackPosition) -> bool
 {
 	bool onSnack{ false };
 	std::for_each(mBody.begin(), mBody.end(), [&](auto& bodyPoint)
@@ -149,17 +269,22 @@ auto Snake::isOnSnack(const Point& snackPosition) -> bool
 	return onSnack;
 }
 
-auto Snake::getBody() -> std::deque<Snake::Point>&
+auto SnakeBase::getBody() -> std::deque<Point>&
 {
 	return mBody;
 }
 
-auto Snake::getLength() -> std::size_t
+auto SnakeBase::getPreviousTail() -> const Point&
+{
+	return mPreviousTail;
+}
+
+auto SnakeBase::getLength() -> std::size_t
 {
 	return mBody.size();
 }
 
-auto Snake::getDirectionsRelativeCoords(Direction direction) -> Point
+auto SnakeBase::getDirectionsRelativeCoords(Direction direction) -> Point
 {
 	Point relativeCoordinates{};
 	switch (direction)
@@ -190,7 +315,7 @@ auto Snake::getDirectionsRelativeCoords(Direction direction) -> Point
 	return relativeCoordinates;
 }
 
-auto Snake::isEatingItself() -> bool
+auto SnakeBase::isEatingItself() -> bool
 {
 	Point& head{ mBody.front() };
 	bool eatsItself{ false };
@@ -201,55 +326,125 @@ auto Snake::isEatingItself() -> bool
 	return eatsItself;
 }
 
-auto Snake::turnLeft() -> void
+auto SnakeBase::turnLeft() -> void
 {
 	int viewDirectionAsInt{ static_cast<int>(mViewDirection) };
 	viewDirectionAsInt = (viewDirectionAsInt + 3) % 4;
 	this->turn(static_cast<Direction>(viewDirectionAsInt));
 }
 
-auto Snake::turnRight() -> void
+auto SnakeBase::turnRight() -> void
 {
 	int viewDirectionAsInt{ static_cast<int>(mViewDirection) };
 	viewDirectionAsInt = (viewDirectionAsInt + 1) % 4;
 	this->turn(static_cast<Direction>(viewDirectionAsInt));
 }
 
-auto Snake::getSpeed() -> double
+auto SnakeBase::getSpeed() -> double
 {
 	return mCurrentMovementSpeed;
 }
 
-auto Snake::getOpposite(Direction direction) -> Direction
+auto SnakeBase::getOpposite(Direction direction) -> Direction
 {
 	int directionAsInt{ static_cast<int>(direction) };
 	return static_cast<Direction>((directionAsInt + 2) % 4);
 }
 
-auto Snake::getLevel() -> std::int32_t
+auto SnakeBase::getStepBetween(const Point& from, const Point& to) -> Point
+{
+	const auto toStep{ [](const std::int32_t distance) -> std::int32_t
+	{
+	  return std::abs(distance) <= 1 ? distance : (distance < 0 ? 1 : -1);
+	} };
+	return { toStep(to.first - from.first), toStep(to.second - from.second) };
+}
+
+auto SnakeBase::getDirectionBetween(const Point& from, const Point& to) -> Direction
+{
+	const auto [xStep, yStep]{ SnakeBase::getStepBetween(from, to) };
+	assert(std::abs(xStep) + std::abs(yStep) == 1 && "Points aren't adjacent");
+
+	using
+	enum Direction;
+	if (xStep != 0)
+	{
+		return xStep > 0 ? EAST : WEST;
+	}
+	return yStep > 0 ? SOUTH : NORTH;
+}
+
+auto SnakeBase::getLevel() -> std::int32_t
 {
 	return mLevel;
 }
 
 // TODO Is this really the correct way of doing move directives? :/
-Snake& Snake::operator=(Snake&& snake) noexcept
+SnakeBase& SnakeBase::operator=(SnakeBase&& snake) noexcept
 {
 	mBody = std::move(snake.mBody);
 	mGameFrameDimension = std::move(snake.mGameFrameDimension);
 
 	mViewDirection = snake.mViewDirection;
 	mTailDirection = snake.mTailDirection;
+	mPreviousTail = snake.mPreviousTail;
 	mCurrentMovementSpeed = snake.mCurrentMovementSpeed;
 	mCurrentSpeedUpCountDownStart = snake.mCurrentSpeedUpCountDownStart;
+	mCurrentSpeedUpCountDown = snake.mCurrentSpeedUpCountDown;
 	mLevel = snake.mLevel;
+	mHistory = std::move(snake.mHistory);
+	mHasCrashed = snake.mHasCrashed;
 
 	return *this;
 }
 
-auto Snake::levelUp() -> void
+auto SnakeBase::levelUp() -> void
 {
 	++mLevel;
-	mCurrentMovementSpeed *= 1.25;
+	// Calculated from the level instead of multiplying the last speed to be exactly reversible by levelDown()
+	mCurrentMovementSpeed = mInitialMovementSpeed * std::pow(1.25, mLevel - 1);
 	mConsoleLogger->info("It's time for a speedup! Snake now moves every {}s.",
 		static_cast<double>(1) / mCurrentMovementSpeed);
 }
+
+auto SnakeBase::levelDown() -> void
+{
+	--mLevel;
+	--mCurrentSpeedUpCountDownStart;
+	mCurrentMovementSpeed = mInitialMovementSpeed * std::pow(1.25, mLevel - 1);
+}
+
+template class BasicSnake<Rules::WrapAround, Rules::NoObstacles>;
+template class BasicSnake<Rules::SolidBorder, Rules::NoObstacles>;
+template class BasicSnake<Rules::WrapAround, Rules::MapObstacles>;
+template class BasicSnake<Rules::SolidBorder, Rules::MapObstacles>;
+
+auto RuleSet::getGameFrameDimension(const Snake::Point& defaultDimension) const -> Snake::Point
+{
+	return gameMap ? gameMap->getGameFrameDimension() : defaultDimension;
+}
+
+auto RuleSet::createSnake(const Snake::Point& gameFrameDimension) const -> AnySnake
+{
+	if (gameMap)
+	{
+		if (isSolidBorder)
+		{
+			return BasicSnake<Rules::SolidBorder, Rules::MapObstacles>::fromMap(gameMap);
+		}
+		return BasicSnake<Rules::WrapAround, Rules::MapObstacles>::fromMap(gameMap);
+	}
+	if (isSolidBorder)
+	{
+		return BasicSnake<Rules::SolidBorder, Rules::NoObstacles>{ gameFrameDimension };
+	}
+	return BasicSnake<Rules::WrapAround, Rules::NoObstacles>{ gameFrameDimension };
+}
+
+auto RuleSet::getBase(AnySnake& snake) -> SnakeBase&
+{
+	return std::visit([](SnakeBase& base) -> SnakeBase&
+	{
+	  return base;
+	}, snake);
+}
@@ -1,12 +1,22 @@
 #pragma once
 
+#include "RingBuffer.hpp"
+#include "RandomSource.hpp"
+#include "Rules.hpp"
+
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 #include <deque>
+#include <memory>
+#include <type_traits>
 #include <utility>
+#include <variant>
 #include <cstdint>
 
-class Snake
+/**
+ * Everything of the snake independent of the game rules, which are added by the BasicSnake below
+ */
+class SnakeBase
 {
  public:
 	enum class Direction
@@ -14,10 +24,30 @@ class Snake
 		NORTH, EAST, SOUTH, WEST
 	};
 	/// Assuming simple (x,y) tuple
-	using Point = std::pair<std::int32_t, std::int32_t>;
+	using Point = Rules::Point;
+
+ protected:
+	/**
+	 * Everything needed to revert one move() call, kept as small as possible to store a long history.
+	 * The new head is always the front of the body, so only the trimmed tail has to be remembered.
+	 */
+	struct TickDelta
+	{
+		/// Snack position before the move, only valid if it was eaten
+		std::int16_t eatenSnackX;
+		std::int16_t eatenSnackY;
+		std::uint8_t viewDirection: 2;
+		std::uint8_t tailDirection: 2;
+		/// Direction from the tail after the move to the trimmed tail, only valid if no snack was eaten
+		std::uint8_t trimmedTailDirection: 2;
+		std::uint8_t ateSnack: 1;
+		std::uint8_t leveledUp: 1;
+	};
+	static_assert(sizeof(TickDelta) == 6, "The rewind history should only cost a few bytes per move");
 
- private:
 	static const std::shared_ptr<spdlog::logger> mConsoleLogger;
+	constexpr static double mInitialMovementSpeed{ 3 };
+	constexpr static std::int32_t mDefaultSpeedUpCountDown{ 3 };
 
 	std::deque<Point> mBody;
 	/// (rightX,bottomY)), inclusive intervall [leftX,rightX], not exclusive!
@@ -26,25 +56,22 @@ class Snake
 	double mCurrentMovementSpeed;
 	/// Snacks to be eaten to speed up the snake, increases every time a full snack set is eaten. See move methods for details
 	std::int32_t mCurrentSpeedUpCountDownStart;
+	/// Counts down on every eaten snack, if 0 is reached the snake levels up
+	std::int32_t mCurrentSpeedUpCountDown;
 	std::int32_t mLevel;
 	Direction mViewDirection;
 	/// To disallow the snakes head to "eat itself" by moving in its own body by doing a 180° flip
 	Direction mTailDirection;
+	/// Tail position before the last move, equals the current tail if the snake grew. Used for interpolated drawing
+	Point mPreviousTail;
+	/// Reverts of the last moves, used to rewind the game
+	RingBuffer<TickDelta> mHistory;
+	/// Set if the last move ran into a solid border or an obstacle, the body stays where it was. Reverted by stepBack()
+	bool mHasCrashed;
 
  public:
-	explicit Snake(const Point& gameFrameDimension,
-		const Point& start, Direction direction = Direction::EAST, std::int32_t length = 4, std::int32_t speedUpCountDown = 3);
-	/// Automatically emits the middle of the playfiled & uses this point to spawn the snake
-	explicit Snake(const Point& gameFrameDimension, Direction direction = Direction::EAST, std::int32_t length = 4);
-
-	/**
-	 * Moves the snake by deleting the last body point & adding a new one to the view direction. If isOnSnack() is true the tail is not trimmed & the snake grows
-	 * If a game field border is coressed, the values are auomatically adjusted to spawn the new head point to the opposite border.
-	 * If mCurrentSpeedUpCountDownStart snacks were eaten by the snake, the snake levels up resulting in a speed increase. Then the snake resets the level-up countdown to ++mCurrentSpeedUpCountDownStart
-	 *
-	 * @return true if the snake ate a snack, needed for the Qt QFrame TODO
-	 */
-	auto move(const Point& snackPosition) -> bool;
+	/// Number of moves which can be reverted by default, costing sizeof(TickDelta) = 6 bytes per move
+	constexpr static std::size_t mDefaultRewindCapacity{ 10'000 };
 
 	/**
 	 * Sets the viewing direction to the specified value. If the current direction is the same as the specified or the
@@ -60,25 +87,122 @@ class Snake
 	auto isEatingItself() -> bool;
 	/// Iterates through the wohle snake body to check if a snack is spawned under it or the snake just ate one
 	auto isOnSnack(const Point& snackPosition) -> bool;
-	auto getBody() -> std::deque<Snake::Point>&;
+	auto getBody() -> std::deque<Point>&;
+	/// The tail point which was trimmed by the last move() call, or the current tail if nothing was trimmed
+	auto getPreviousTail() -> const Point&;
 	auto getLength() -> std::size_t;
 	auto getSpeed() -> double;
 	auto getLevel() -> std::int32_t;
 
+	/// Returns the step of at most one in x & y leading from a point to an adjacent one. Points further apart than one
+	/// are lying on opposite borders, so their step is inverted to wrap around the game field border
+	static auto getStepBetween(const Point& from, const Point& to) -> Point;
+	/// Returns the direction leading from a point to an adjacent one, considering moves around the game field border
+	static auto getDirectionBetween(const Point& from, const Point& to) -> Direction;
+
+ protected:
+	/// Checks the game frame & lines up the body behind the start point, which may still leave the game frame
+	SnakeBase(const Point& gameFrameDimension, const Point& start, Direction direction, std::int32_t length,
+		std::int32_t speedUpCountDown, std::size_t rewindCapacity);
+	SnakeBase(SnakeBase&& snake) noexcept = default;
+
 	/// Reinitialization of a snake when the game (re)starts TODO
-	Snake& operator=(Snake&& snake) noexcept;
+	SnakeBase& operator=(SnakeBase&& snake) noexcept;
 
- private:
 	static auto getDirectionsRelativeCoords(Direction direction) -> Point;
 	static auto getOpposite(Direction direction) -> Direction;
-	/**
-	 * Return the relative position point to a given direction.
-	 * E.g. if NORTH is the argument, the return value is (-1,0) which should be equals
-	 * the northern direction in QT applications
-	 * @param direction
-	 * @return North = (0,-1), East (1,0), South (0,1), West (-1,0)
-	 */
-	auto changeToPlayFieldAwarePosition(Point& point) -> void;
 	/// Enhances the speed by 1/4
 	auto levelUp() -> void;
-};
\ No newline at end of file
+	/// Reverts levelUp()
+	auto levelDown() -> void;
+};
+
+/**
+ * The snake following the game rules chosen by the policies of Rules.hpp. Only the variants instantiated at the end of
+ * Snake.cpp are available.
+ *
+ * @tparam Topology What happens at the game frame border, Rules::WrapAround or Rules::SolidBorder
+ * @tparam Obstacles Cells the snake crashes into, Rules::NoObstacles or Rules::MapObstacles
+ */
+template<typename Topology = Rules::WrapAround, typename Obstacles = Rules::NoObstacles>
+class BasicSnake : public SnakeBase
+{
+	[[no_unique_address]] Obstacles mObstacles;
+
+ public:
+	explicit BasicSnake(const Point& gameFrameDimension,
+		const Point& start, Direction direction = Direction::EAST, std::int32_t length = 4, std::int32_t speedUpCountDown = mDefaultSpeedUpCountDown,
+		std::size_t rewindCapacity = mDefaultRewindCapacity, Obstacles obstacles = Obstacles{});
+	/// Automatically emits the middle of the playfiled & uses this point to spawn the snake
+	explicit BasicSnake(const Point& gameFrameDimension, Direction direction = Direction::EAST, std::int32_t length = 4)
+	requires std::is_default_constructible_v<Obstacles>;
+	/// Spawns the snake where the map says. Its walls only apply if the Obstacles policy enables them
+	static auto fromMap(const std::shared_ptr<const GameMap>& gameMap, std::int32_t length = 4) -> BasicSnake;
+	BasicSnake(BasicSnake&& snake) noexcept = default;
+
+	/**
+	 * Moves the snake by deleting the last body point & adding a new one to the view direction. If isOnSnack() is true the tail is not trimmed & the snake grows
+	 * If a game field border is coressed, the values are auomatically adjusted to spawn the new head point to the opposite border.
+	 * If mCurrentSpeedUpCountDownStart snacks were eaten by the snake, the snake levels up resulting in a speed increase. Then the snake resets the level-up countdown to ++mCurrentSpeedUpCountDownStart
+	 * With a solid border or obstacles the snake may crash instead, leaving the body untouched, see isDead()
+	 *
+	 * @return true if the snake ate a snack, needed for the Qt QFrame TODO
+	 */
+	auto move(const Point& snackPosition) -> bool;
+
+	/**
+	 * Reverts the last move() call by restoring the body, directions, level & speed. Runs in O(1) without copying the body.
+	 * Only the last rewindCapacity moves are remembered. A crash is reverted like a move.
+	 *
+	 * @param snackPosition Set to the snacks position before the move if the reverted move ate it, untouched otherwise
+	 * @return false if there is no move left to revert
+	 */
+	auto stepBack(Point& snackPosition) -> bool;
+	auto canStepBack() -> bool;
+
+	/// If the snake ate itself or crashed into a wall, which is checked at compile time to be impossible for the default rules
+	auto isDead() -> bool;
+	/// Draws random positions of the game frame until one is neither covered by the body nor by an obstacle. The same stream always leads to the same snacks
+	auto generateSnack(RandomSource& randomSource) -> Point;
+
+	BasicSnake& operator=(BasicSnake&& snake) noexcept;
+
+ private:
+	/**
+	 * Brings a point which just left the game frame back in like the Topology says.
+	 * @param point Point one step outside or inside the game frame, changed in place when wrapping around
+	 * @return False if the point crashed into a solid border, the point stays unchanged then. Always true when wrapping around
+	 */
+	auto changeToPlayFieldAwarePosition(Point& point) -> bool;
+};
+
+/// The original rules: wrapping around the borders of an empty board
+using Snake = BasicSnake<>;
+
+extern template class BasicSnake<Rules::WrapAround, Rules::NoObstacles>;
+extern template class BasicSnake<Rules::SolidBorder, Rules::NoObstacles>;
+extern template class BasicSnake<Rules::WrapAround, Rules::MapObstacles>;
+extern template class BasicSnake<Rules::SolidBorder, Rules::MapObstacles>;
+
+/**
+ * Game rules chosen at runtime, e.g. on the command line. The snake is created as the matching BasicSnake, so choosing
+ * the rules costs one std::visit dispatch per call instead of checks for every variant inside of each move.
+ */
+struct RuleSet
+{
+	using AnySnake = std::variant<BasicSnake<Rules::WrapAround, Rules::NoObstacles>,
+		BasicSnake<Rules::SolidBorder, Rules::NoObstacles>, BasicSnake<Rules::WrapAround, Rules::MapObstacles>,
+		BasicSnake<Rules::SolidBorder, Rules::MapObstacles>>;
+
+	/// Crashing into the game frame border instead of wrapping around
+	bool isSolidBorder{ false };
+	/// Level with walls, which also sets the game frame dimension & the spawn point. Without it the board is empty
+	std::shared_ptr<const GameMap> gameMap{};
+
+	/// The dimension of the map, the given one without a map
+	auto getGameFrameDimension(const Snake::Point& defaultDimension) const -> Snake::Point;
+	/// Spawns the snake where the map says, or in the middle of the game frame without a map
+	auto createSnake(const Snake::Point& gameFrameDimension) const -> AnySnake;
+	/// The rule independent part of the snake, e.g. for turning & drawing it
+	static auto getBase(AnySnake& snake) -> SnakeBase&;
+};
@@ -1,23 +1,38 @@
 #include "SnakeGameFrame.hpp"
+#include "ZobristHash.hpp"
 
 #include <QPainter>
 #include <QKeyEvent>
+#include <QWindow>
 #include <QtCore/QCoreApplication>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <random>
 
 std::shared_ptr<spdlog::logger> const SnakeGameFrame::mConsoleLogger{ spdlog::stderr_color_mt("Game Field") };
 
-SnakeGameFrame::SnakeGameFrame(QWidget* parent, QStatusBar* statusBar, const Snake::Point gameFrameSize)
+namespace
+{
+	auto createRandomSeed() -> std::uint64_t
+	{
+		std::random_device randomDevice{};
+		return std::uint64_t{ randomDevice() } << 32 | randomDevice();
+	}
+}
+
+SnakeGameFrame::SnakeGameFrame(QWidget* parent, QStatusBar* statusBar, const Snake::Point gameFrameSize, RuleSet rules)
 	: QFrame(parent), mGameStatusBar(statusBar), mPainter(this), mSnakeMoveTimer(new QTimer(this)),
-	  mSnackDistribution(
-		  std::uniform_int_distribution{ 0, gameFrameSize.first },
-		  std::uniform_int_distribution{ 0, gameFrameSize.second }),
-	  mSnake(gameFrameSize), mGameFrameSize(gameFrameSize), mIsGameRunning(false)
+	  mTickScheduler(TickScheduler::Period{ 1'000 }),
+	  mRandomSeed(createRandomSeed()), mGameCount(0), mRandomSource(), mSnackStreamPositions(), mGameQFrameSize(),
+	  mRules(std::move(rules)), mSnake(mRules.createSnake(mRules.getGameFrameDimension(gameFrameSize))),
+	  mGameFrameSize(mRules.getGameFrameDimension(gameFrameSize)), mSnack(), mIsGameRunning(false),
+	  mIsGamePaused(false), mAutopilotPolicy(), mIsAutopilotEnabled(false)
 {
 	// Setting the dimension of the game frame
-	QSize qFrameSize{ SnakeGameFrame::calculateGameFrameSize(gameFrameSize) };
+	QSize qFrameSize{ SnakeGameFrame::calculateGameFrameSize(mGameFrameSize) };
 	mGameQFrameSize = qFrameSize;
 	this->setGeometry(0, 0, qFrameSize.width(), qFrameSize.height());
 
@@ -28,8 +43,12 @@ SnakeGameFrame::SnakeGameFrame(QWidget* parent, QStatusBar* statusBar, const Sna
 
 	mPainter.setRenderHint(QPainter::Antialiasing);
 
-	// Connecting the timer with the snake moving/game logic
-	connect(mSnakeMoveTimer.get(), &QTimer::timeout, this, &SnakeGameFrame::snakeCoordinator);
+	// Connecting the timer with the snake moving/game logic. The timer only wakes up the event loop, the tick
+	// scheduler decides how many moves are due
+	mSnakeMoveTimer->setSingleShot(true);
+	mSnakeMoveTimer->setTimerType(Qt::PreciseTimer);
+	connect(mSnakeMoveTimer.get(), &QTimer::timeout, this, &SnakeGameFrame::runDueSnakeMovements);
+	// Repainting is decoupled from the game logic to draw the snake in between two moves, see requestFrame()
 	// Initially execute draw event
 	//this->update(); // Seems to be done implicitly by the main windows in the main method
 }
@@ -39,49 +58,190 @@ auto SnakeGameFrame::startGame() -> void
 	mConsoleLogger->info("Staring game.");
 	mIsGameRunning = true;
 
+	// Logged to replay the game with the same snacks, see Replay
+	mConsoleLogger->info("Placing snacks with seed {:d} & game id {:d}", mRandomSeed, mGameCount);
+	mRandomSource = std::make_unique<CounterRandomSource>(mRandomSeed, mGameCount++);
+	mSnackStreamPositions.clear();
+
 	this->generateNewSnack();
+	this->resumeGame();
+}
+
+auto SnakeGameFrame::resumeGame() -> void
+{
+	mIsGamePaused = false;
 
 	// Initially paint snake on the frame by calling the overwritten paintEvent method
 	update();
-	// Setting status bar message
-	std::string statusBarMessage{
-		fmt::format("Length: {:d}, Level: {:d} / {:d}ms", mSnake.getLength(), mSnake
-			.getLevel(), SnakeGameFrame::getSnakeMovementIntervall()) };
+	this->updateStatusBar();
+
+	mTickScheduler.setPeriod(SnakeGameFrame::getSnakeMovementIntervall());
+	mTickScheduler.start(TickScheduler::Clock::now());
+	this->runDueSnakeMovements();
+	this->requestFrame();
+}
+
+auto SnakeGameFrame::rewindGame() -> void
+{
+	const std::size_t lengthBefore{ this->getSnake().getLength() };
+	const bool hasSteppedBack{ std::visit([this](auto& snake)
+	{
+	  return snake.stepBack(mSnack);
+	}, mSnake) };
+	if (!hasSteppedBack)
+	{
+		return;
+	}
+	// Un-eating a snack rewinds its stream as well, so the game places the same snacks like without rewinding
+	if (this->getSnake().getLength() < lengthBefore && !mSnackStreamPositions.empty())
+	{
+		mRandomSource->setPosition(mSnackStreamPositions.back());
+		mSnackStreamPositions.pop_back();
+	}
+
+	mSnakeMoveTimer->stop();
+	mIsGameRunning = true;
+	mIsGamePaused = true;
+
+	this->updateStatusBar();
+	this->update();
+}
+
+auto SnakeGameFrame::getSnakeMovementIntervall() -> TickScheduler::Period
+{
+	return TickScheduler::Period{ 1'000 / this->getSnake().getSpeed() };
+}
+
+auto SnakeGameFrame::getTickProgress() -> double
+{
+	// Nothing to interpolate before the first move & while the snake stands still
+	if (mIsGamePaused || mTickScheduler.getTotalTicks() == 0)
+	{
+		return 1;
+	}
+	return mTickScheduler.getTickProgress(TickScheduler::Clock::now());
+}
+
+auto SnakeGameFrame::updateStatusBar() -> void
+{
+	std::string statusBarMessage{ fmt::format("Length: {:d}, Level: {:d} / {:.2f}ms{}", this->getSnake().getLength(),
+		this->getSnake().getLevel(), SnakeGameFrame::getSnakeMovementIntervall().count(), mIsGamePaused ? " - Paused" : "") };
 	mGameStatusBar->showMessage(QString{ statusBarMessage.c_str() });
+}
+
+auto SnakeGameFrame::runDueSnakeMovements() -> void
+{
+	const auto now{ TickScheduler::Clock::now() };
+	mTickScheduler.update(now, [this]
+	{
+	  return this->snakeCoordinator();
+	});
+
+	if (mIsGameRunning)
+	{
+		// Rounding up wakes the event loop at most a millisecond late, the scheduler catches up on the missed moves
+		const auto untilNextTick{ std::chrono::ceil<std::chrono::milliseconds>(mTickScheduler.getTimeUntilNextTick(now)) };
+		mSnakeMoveTimer->start(untilNextTick);
+	}
+}
 
-	mSnakeMoveTimer->start(SnakeGameFrame::getSnakeMovementIntervall());
+auto SnakeGameFrame::setAutopilotPolicy(Policy policy) -> void
+{
+	if (policy.getGameFrameDimension() != mGameFrameSize)
+	{
+		mConsoleLogger->warn("Ignoring autopilot policy solved for a ({},{}) game frame", policy.getGameFrameDimension()
+			.first, policy.getGameFrameDimension().second);
+		return;
+	}
+	if (mRules.isSolidBorder || mRules.gameMap)
+	{
+		mConsoleLogger->warn("Ignoring autopilot policy, it was solved for a wrapping board without walls");
+		return;
+	}
+	mAutopilotPolicy = std::move(policy);
 }
 
-auto SnakeGameFrame::getSnakeMovementIntervall() -> std::int32_t
+auto SnakeGameFrame::setRandomSeed(const std::uint64_t seed) -> void
 {
-	const double buffer{ (static_cast<double>(1) / mSnake.getSpeed()) * 1'000 };
-	return static_cast<int>(buffer);
+	mRandomSeed = seed;
+	mGameCount = 0;
 }
 
-auto SnakeGameFrame::snakeCoordinator() -> void
+auto SnakeGameFrame::steerByAutopilot() -> void
 {
-	bool ateSnack = mSnake.move(mSnack);
+	const std::uint64_t gameHash{ ZobristHash::hash(this->getSnake().getBody(), mSnack, mGameFrameSize) };
+	if (const auto entry{ mAutopilotPolicy->lookup(gameHash) })
+	{
+		this->getSnake().turn(entry->direction);
+	}
+}
+
+auto SnakeGameFrame::snakeCoordinator() -> bool
+{
+	if (mIsAutopilotEnabled)
+	{
+		this->steerByAutopilot();
+	}
+
+	// The only dispatch on the rules per move, the move itself is compiled for them
+	bool ateSnack = std::visit([this](auto& snake)
+	{
+	  return snake.move(mSnack);
+	}, mSnake);
 	if (ateSnack)
 	{
+		mSnackStreamPositions.push_back(mRandomSource->getPosition());
 		this->generateNewSnack();
-		mSnakeMoveTimer->setInterval(getSnakeMovementIntervall());
+		mTickScheduler.setPeriod(getSnakeMovementIntervall());
 
 		// Updating status bar message
-		std::string statusBarMessage{ fmt::format("Length: {:d}, Level: {:d} / {:d}ms", mSnake.getLength(), mSnake
-			.getLevel(), SnakeGameFrame::getSnakeMovementIntervall()) };
-		mGameStatusBar->showMessage(QString{ statusBarMessage.c_str() });
+		this->updateStatusBar();
 	}
-	if (mSnake.isEatingItself())
+	if (std::visit([](auto& snake)
+	{
+	  return snake.isDead();
+	}, mSnake))
 	{
+		// The title screen is static, so no further frames are requested until the next game starts
 		mSnakeMoveTimer->stop();
-
 		mIsGameRunning = false;
 		this->update();
 
-		mGameStatusBar->showMessage("");
+		mGameStatusBar->showMessage("Press R to rewind");
 	}
+	return mIsGameRunning;
+}
 
-	this->update();
+auto SnakeGameFrame::showEvent(QShowEvent*) -> void
+{
+	// Only the top level window receives the update requests paced by the display
+	if (QWindow* window{ this->window()->windowHandle() })
+	{
+		window->installEventFilter(this);
+	}
+}
+
+auto SnakeGameFrame::eventFilter(QObject* watched, QEvent* event) -> bool
+{
+	// Repainting before the window handles the request draws the frame in the same display refresh
+	if (event->type() == QEvent::UpdateRequest && mIsGameRunning && !mIsGamePaused)
+	{
+		this->update();
+		this->requestFrame();
+	}
+	return QFrame::eventFilter(watched, event);
+}
+
+auto SnakeGameFrame::requestFrame() -> void
+{
+	if (!mIsGameRunning || mIsGamePaused)
+	{
+		return;
+	}
+	if (QWindow* window{ this->window()->windowHandle() })
+	{
+		window->requestUpdate();
+	}
 }
 
 auto SnakeGameFrame::paintEvent(QPaintEvent*) -> void
@@ -95,30 +255,8 @@ auto SnakeGameFrame::paintEvent(QPaintEvent*) -> void
 	// Painting snakes body
 	if (mIsGameRunning)
 	{
-		// Painting snack to make sure it is drawn over the body when eating itself
-		mPainter.setBrush(Qt::GlobalColor::green);
-		mPainter.setPen(Qt::GlobalColor::green);
-		mPainter.drawRect(SnakeGameFrame::transformPointToDisplayTile(mSnack));
-
-		mPainter.setPen(Qt::GlobalColor::black);
-		mPainter.setBrush(Qt::GlobalColor::black);
-		// Draw the snakes body
-		auto& snakesBody{ mSnake.getBody() };
-		std::for_each(snakesBody.begin() + 1, snakesBody.end(), [this](auto& snakeBodyPoint)
-		{
-		  const QRect snakeBodyRect{ SnakeGameFrame::transformPointToDisplayTile(snakeBodyPoint) };
-		  mPainter.drawRect(snakeBodyRect);
-		});
-
-		// Draw the snakes head
-		mPainter.setBrush(Qt::GlobalColor::red);
-		mPainter.setPen(Qt::GlobalColor::red);
-		mPainter.drawRect(SnakeGameFrame::transformPointToDisplayTile(snakesBody.front()));
-
-		// Draw game border
-		mPainter.setBrush(Qt::NoBrush);
-		mPainter.setPen(Qt::GlobalColor::yellow);
-		mPainter.drawRect(0, 0, mGameQFrameSize.width() - 1, mGameQFrameSize.height() - 1); // Idk...
+		SnakeGameFrame::drawGame(mPainter, this->getSnake(), mSnack, mGameQFrameSize, this->getTickProgress(),
+			mRules.gameMap.get());
 	}
 	else
 	{ // The start game screen is shown
@@ -133,6 +271,83 @@ auto SnakeGameFrame::paintEvent(QPaintEvent*) -> void
 	mPainter.end();
 }
 
+auto SnakeGameFrame::drawGame(QPainter& painter, SnakeBase& snake, const Snake::Point& snack, const QSize& frameSize,
+	const double tickProgress, const GameMap* gameMap) -> void
+{
+	if (gameMap != nullptr)
+	{
+		painter.setBrush(Qt::GlobalColor::gray);
+		painter.setPen(Qt::GlobalColor::gray);
+		const auto [xDimension, yDimension] = gameMap->getGameFrameDimension();
+		for (std::int32_t y{ 0 }; y <= yDimension; ++y)
+		{
+			for (std::int32_t x{ 0 }; x <= xDimension; ++x)
+			{
+				if (gameMap->isWall({ x, y }))
+				{
+					painter.drawRect(SnakeGameFrame::transformPointToDisplayTile({ x, y }));
+				}
+			}
+		}
+	}
+
+	// Painting snack to make sure it is drawn over the body when eating itself
+	painter.setBrush(Qt::GlobalColor::green);
+	painter.setPen(Qt::GlobalColor::green);
+	painter.drawRect(SnakeGameFrame::transformPointToDisplayTile(snack));
+
+	painter.setPen(Qt::GlobalColor::black);
+	painter.setBrush(Qt::GlobalColor::black);
+	// Draw the snakes body
+	auto& snakesBody{ snake.getBody() };
+	std::for_each(snakesBody.begin() + 1, snakesBody.end(), [&painter](auto& snakeBodyPoint)
+	{
+	  const QRect snakeBodyRect{ SnakeGameFrame::transformPointToDisplayTile(snakeBodyPoint) };
+	  painter.drawRect(snakeBodyRect);
+	});
+	// The trimmed tail slides into the new tail, does nothing if the snake grew
+	SnakeGameFrame::drawInterpolatedTile(painter, snake.getPreviousTail(), snakesBody.back(), tickProgress);
+
+	// Draw the snakes head sliding from its last position to the current one
+	painter.setBrush(Qt::GlobalColor::red);
+	painter.setPen(Qt::GlobalColor::red);
+	if (snakesBody.size() > 1)
+	{
+		SnakeGameFrame::drawInterpolatedTile(painter, snakesBody[1], snakesBody.front(), tickProgress);
+	}
+	else
+	{
+		painter.drawRect(SnakeGameFrame::transformPointToDisplayTile(snakesBody.front()));
+	}
+
+	// Draw game border
+	painter.setBrush(Qt::NoBrush);
+	painter.setPen(Qt::GlobalColor::yellow);
+	painter.drawRect(0, 0, frameSize.width() - 1, frameSize.height() - 1); // Idk...
+}
+
+auto SnakeGameFrame::drawInterpolatedTile(QPainter& painter, const Snake::Point& from, const Snake::Point& to,
+	const double progress) -> void
+{
+	const Snake::Point step{ Snake::getStepBetween(from, to) };
+
+	const auto drawStep{ [&](const Snake::Point& stepStart, const Snake::Point& stepEnd)
+	{
+	  const QRect startTile{ SnakeGameFrame::transformPointToDisplayTile(stepStart) };
+	  const QRect endTile{ SnakeGameFrame::transformPointToDisplayTile(stepEnd) };
+	  const QPointF topLeft{ startTile.topLeft() + QPointF{ endTile.topLeft() - startTile.topLeft() } * progress };
+	  painter.drawRect(QRectF{ topLeft, QSizeF{ mTileDimension }});
+	} };
+
+	// Tiles outside the frame are clipped by the painter, which makes a tile leave on one border & enter on the other
+	const Snake::Point unwrappedTo{ from.first + step.first, from.second + step.second };
+	drawStep(from, unwrappedTo);
+	if (unwrappedTo != to)
+	{
+		drawStep({ to.first - step.first, to.second - step.second }, to);
+	}
+}
+
 auto SnakeGameFrame::calculateGameFrameSize(const Snake::Point& frameSize) -> QSize
 {
 	// "+2" for displaying the first & last margin gap for the outer rectangle margins
@@ -146,22 +361,18 @@ auto SnakeGameFrame::calculateGameFrameSize(const Snake::Point& frameSize) -> QS
 
 auto SnakeGameFrame::generateNewSnack() -> void
 {
-	static std::random_device rd{};
-	static std::seed_seq seedSeq{
-		static_cast<unsigned int> (std::chrono::high_resolution_clock::now().time_since_epoch().count()),
-		rd(), rd(), rd(), rd(), rd(), rd(), rd(), rd() };
-	static std::mt19937 snackMT{ seedSeq }; // TODO use a more performant thing here
-
-	auto& [firstDirstr, secondDistr] = mSnackDistribution;
-	// Prevents the snack from spawning in the snake
-	while (mSnake.isOnSnack(mSnack))
+	mSnack = std::visit([this](auto& snake)
 	{
-		mSnack = { firstDirstr(snackMT), secondDistr(snackMT) };
-	}
-
+	  return snake.generateSnack(*mRandomSource);
+	}, mSnake);
 	mConsoleLogger->info("Generating new snack on ({},{})", mSnack.first, mSnack.second);
 }
 
+auto SnakeGameFrame::getSnake() -> SnakeBase&
+{
+	return RuleSet::getBase(mSnake);
+}
+
 auto SnakeGameFrame::transformPointToDisplayTile(const Snake::Point& gameFieldPoint) -> QRect
 {
 	const QPoint qRectStartingPoint{
@@ -182,25 +393,42 @@ void SnakeGameFrame::keyPressEvent(QKeyEvent* qKeyEvent)
 			enum Snake::Direction;
 		case Qt::Key::Key_W:
 		{
-			mSnake.turn(NORTH);
+			this->getSnake().turn(NORTH);
 			break;
 		}
 		case Qt::Key::Key_D:
 		{
-			mSnake.turn(EAST);
+			this->getSnake().turn(EAST);
 			break;
 		}
 		case Qt::Key::Key_S:
 		{
-			mSnake.turn(SOUTH);
+			this->getSnake().turn(SOUTH);
 			break;
 		}
 		case Qt::Key::Key_A:
 		{
-			mSnake.turn(WEST);
+			this->getSnake().turn(WEST);
+			break;
+		}
+		case Qt::Key::Key_R:
+		{
+			this->rewindGame();
+			return;
+		}
+		case Qt::Key::Key_P:
+		{
+			mIsAutopilotEnabled = !mIsAutopilotEnabled && mAutopilotPolicy.has_value();
+			mConsoleLogger->info("Autopilot {}", mIsAutopilotEnabled ? "enabled" : "disabled");
 			break;
 		}
 		}
+
+		// Any other key continues a rewound game
+		if (mIsGamePaused)
+		{
+			this->resumeGame();
+		}
 	}
 	else
 	{
@@ -208,8 +436,14 @@ void SnakeGameFrame::keyPressEvent(QKeyEvent* qKeyEvent)
 		{
 		case Qt::Key::Key_Space:
 		{
-			mSnake = Snake{ mGameFrameSize };
+			mSnake = mRules.createSnake(mGameFrameSize);
 			this->startGame();
+			break;
+		}
+		case Qt::Key::Key_R:
+		{
+			this->rewindGame();
+			break;
 		}
 		}
 	}
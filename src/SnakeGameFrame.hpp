@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Snake.hpp"
+#include "TickScheduler.hpp"
+#include "Policy.hpp"
+#include "RandomSource.hpp"
 
 #include <QFrame>
 #include <QTimer>
@@ -8,8 +11,6 @@
 #include <QPainter>
 #include <QStatusBar>
 
-#include <random>
-
 // Standard namespace for classes generated from .ui files - I won't use this...
 /*QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -21,14 +22,42 @@ QT_END_NAMESPACE*/
 class SnakeGameFrame : public QFrame
 {
  public:
+	/// The game frame size is taken from the map of the rules if they have one
 	explicit SnakeGameFrame(QWidget* parent = nullptr, QStatusBar* statusBar = nullptr, Snake::Point gameFrameSize = {
-		14, 14 });
+		14, 14 }, RuleSet rules = {});
+	/// Owns its timer & paints on itself, so it is neither copied nor assigned like any other widget
+	SnakeGameFrame(const SnakeGameFrame&) = delete;
+	auto operator=(const SnakeGameFrame&) -> SnakeGameFrame& = delete;
+
+	/**
+	 * Draws the snack, the snake & the game border of a running game. Independent of any widget, so it can also be
+	 * used to render games offscreen into a QImage, for every rule variant of the snake.
+	 *
+	 * @param tickProgress Progress in [0,1] between the last & the next snake movement, used to interpolate the head & tail
+	 * @param gameMap Map whose walls are drawn, if the snake plays on one
+	 */
+	static auto drawGame(QPainter& painter, SnakeBase& snake, const Snake::Point& snack, const QSize& frameSize,
+		double tickProgress, const GameMap* gameMap = nullptr) -> void;
+	/// Takes the bottom left point of the snake game frame (points on which the actual snake can move) & calculates the
+	/// Qt game field size
+	static auto calculateGameFrameSize(const Snake::Point& frameSize) -> QSize;
+	/// Sets the moves the autopilot follows, which can be toggled with P while playing. Ignored if the policy was solved
+	/// for a different game frame size or the rules differ from the wrapping board without walls the solver plays on
+	auto setAutopilotPolicy(Policy policy) -> void;
+	/// Makes the snack placement reproducible, the n-th game after this call always draws the same snacks, also if it
+	/// was rewound in between. Without it a random seed is used
+	auto setRandomSeed(std::uint64_t seed) -> void;
 
  protected:
 	/// Uses the isGameRunning variable to determine if it should draw the title screen or the snake. Uses mPainter with different color setups to draw
 	void paintEvent(QPaintEvent*) override;
-	/// For actions on key press & timed printing of the game field. Uses the isGameRunning variable to determine if it has to listen on Space or WASD
+	/// For actions on key press & timed printing of the game field. Uses the isGameRunning variable to determine if it has to listen on Space or WASD.
+	/// R rewinds the game by one move, both while playing & after the snake died. P toggles the autopilot
 	void keyPressEvent(QKeyEvent* qKeyEvent) override;
+	/// Watches the update requests of the top level window, once it exists
+	void showEvent(QShowEvent*) override;
+	/// Repaints on every update request of the window while the game is running & not paused
+	bool eventFilter(QObject* watched, QEvent* event) override;
 
  private:
 	static const std::shared_ptr<spdlog::logger> mConsoleLogger;
@@ -36,9 +65,18 @@ class SnakeGameFrame : public QFrame
 	/// To display the current game stats in a text filed below the play field
 	QStatusBar* mGameStatusBar;
 	QPainter mPainter;
+	/// Single shot timer waking up the event loop when the next snake movement is due
 	std::unique_ptr<QTimer> mSnakeMoveTimer;
-	/// Used for distributing snacks along the x & y axis
-	std::pair<std::uniform_int_distribution<int>, std::uniform_int_distribution<int>> mSnackDistribution;
+	/// Decides how many snake movements are due, independent of the timers millisecond resolution
+	TickScheduler mTickScheduler;
+	/// Every game draws its snacks from its own stream of this seed, identified by the game number
+	std::uint64_t mRandomSeed;
+	/// Games started since the seed was set
+	std::uint64_t mGameCount;
+	/// Random stream of the current game, created when the game starts
+	std::unique_ptr<CounterRandomSource> mRandomSource;
+	/// Stream positions before placing each snack after the first one, restored when rewinding the snack eating moves
+	std::vector<std::uint64_t> mSnackStreamPositions;
 
 	/// Used to display font in the middle of the screen
 	QSize mGameQFrameSize;
@@ -47,21 +85,44 @@ class SnakeGameFrame : public QFrame
 	constexpr static int mTileMargin{ 3 };
 
 	// Snake & moving stuff
-	Snake mSnake;
+	RuleSet mRules;
+	/// Snake of the variant the rules chose, see getSnake() for the rule independent part
+	RuleSet::AnySnake mSnake;
 	Snake::Point mGameFrameSize;
 	/// The outest bottom left game coordinate the snake can reach
 	Snake::Point mSnack;
 	bool mIsGameRunning;
+	/// Set after rewinding, the snake stands still until the next key press
+	bool mIsGamePaused;
+	/// Solved moves steering the snake while mIsAutopilotEnabled is set
+	std::optional<Policy> mAutopilotPolicy;
+	bool mIsAutopilotEnabled;
 
-	/// Initially updates the game, starts the timer & sets the isGameRunning variable to true.
-	/// The timer calls the paintEvent & snakeCoordinator functions to move the snake & draw it on the screen
+	/// Initially updates the game, starts the timers & sets the isGameRunning variable to true.
+	/// The timers call the paintEvent & runDueSnakeMovements functions to move the snake & draw it on the screen
 	auto startGame() -> void;
-	auto snakeCoordinator() -> void;
-	/// Takes the bottom left point of the snake game frame (points on which the actual snake can move) & calculates the
-	/// Qt game field size
-	static auto calculateGameFrameSize(const Snake::Point& frameSize) -> QSize;
-	auto getSnakeMovementIntervall() -> std::int32_t;
-	/// Randomly generates a new position for the snack member using a mt wich is statically initialized
+	/// Starts the timers for moving & drawing the snake, used when (re)starting & after pausing
+	auto resumeGame() -> void;
+	/// Reverts the last snake movement & pauses the game. Brings a dead snake back to life
+	auto rewindGame() -> void;
+	/// Lets the tick scheduler run all due snake movements & rearms the timer for the next one
+	auto runDueSnakeMovements() -> void;
+	/// Asks the window for the next frame, which the platform delivers in time with the display refresh. Stops as soon
+	/// as the game is over or paused, so the static title screen doesn't repaint
+	auto requestFrame() -> void;
+	/// Moves the snake once. Returns false if the game is over
+	auto snakeCoordinator() -> bool;
+	/// Turns the snake like the autopilot policy says, if it knows the current game state
+	auto steerByAutopilot() -> void;
+	auto getSnakeMovementIntervall() -> TickScheduler::Period;
+	/// Progress in [0,1] of the time passed between the last & the next snake movement
+	auto getTickProgress() -> double;
+	auto updateStatusBar() -> void;
+	/// Draws a tile on its way from one game field point to an adjacent one. Handles moves around the game field border by drawing the tile on both sides
+	static auto drawInterpolatedTile(QPainter& painter, const Snake::Point& from, const Snake::Point& to,
+		double progress) -> void;
+	/// Randomly generates a new position for the snack member using the random stream of the current game
 	auto generateNewSnack() -> void;
+	auto getSnake() -> SnakeBase&;
 	static auto transformPointToDisplayTile(const Snake::Point& gameFieldPoint) -> QRect;
 };
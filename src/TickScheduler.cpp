@@ -0,0 +1,51 @@
+#include "TickScheduler.hpp"
+
+#include <algorithm>
+
+std::shared_ptr<spdlog::logger> const TickScheduler::mConsoleLogger{ spdlog::stderr_color_mt("Tick Scheduler") };
+
+TickScheduler::TickScheduler(const Period period, const std::int32_t maxTicksPerUpdate)
+	: mPeriod(period), mAnchor(), mTicksSinceAnchor(0), mTotalTicks(0), mMaxTicksPerUpdate(maxTicksPerUpdate)
+{
+}
+
+auto TickScheduler::start(const Clock::time_point now) -> void
+{
+	mAnchor = now;
+	mTicksSinceAnchor = 0;
+	mTotalTicks = 0;
+}
+
+auto TickScheduler::setPeriod(const Period period) -> void
+{
+	// Re-anchoring on the last tick keeps the time already passed since then
+	mAnchor = getTickTime(mTicksSinceAnchor);
+	mTicksSinceAnchor = 0;
+	mPeriod = period;
+}
+
+auto TickScheduler::getPeriod() const -> Period
+{
+	return mPeriod;
+}
+
+auto TickScheduler::getTotalTicks() const -> std::int64_t
+{
+	return mTotalTicks;
+}
+
+auto TickScheduler::getTickProgress(const Clock::time_point now) const -> double
+{
+	const Period sinceLastTick{ now - getTickTime(mTicksSinceAnchor) };
+	return std::clamp(sinceLastTick / mPeriod, 0.0, 1.0);
+}
+
+auto TickScheduler::getTimeUntilNextTick(const Clock::time_point now) const -> Period
+{
+	return std::max(Period{ getTickTime(mTicksSinceAnchor + 1) - now }, Period::zero());
+}
+
+auto TickScheduler::getTickTime(const std::int64_t tickSinceAnchor) const -> Clock::time_point
+{
+	return mAnchor + std::chrono::round<Clock::duration>(mPeriod * static_cast<double>(tickSinceAnchor));
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * Fixed timestep scheduler for the game logic, decoupled from how often the event loop wakes up.
+ * Tick n since the last period change is due at anchor + n * period, so fractional millisecond periods are met exactly
+ * & rounding errors don't accumulate over time. The current time is always passed in, which allows driving the
+ * scheduler with a virtual clock.
+ */
+class TickScheduler
+{
+ public:
+	using Clock = std::chrono::steady_clock;
+	/// Fractional milliseconds, periods below one millisecond are supported
+	using Period = std::chrono::duration<double, std::milli>;
+
+ private:
+	static const std::shared_ptr<spdlog::logger> mConsoleLogger;
+
+	Period mPeriod;
+	/// Point in time the ticks are counted from, moved to the last tick on every period change
+	Clock::time_point mAnchor;
+	std::int64_t mTicksSinceAnchor;
+	/// Ticks executed since start() was called
+	std::int64_t mTotalTicks;
+	/// Upper bound of ticks run by one update() call. If the logic can't keep up the backlog is dropped instead of
+	/// spiraling into ever longer updates
+	std::int32_t mMaxTicksPerUpdate;
+
+ public:
+	explicit TickScheduler(Period period, std::int32_t maxTicksPerUpdate = 32);
+
+	/// (Re)starts counting ticks from the given point in time, the first tick is due one period later
+	auto start(Clock::time_point now) -> void;
+	/// Changes the period for all ticks after the last executed one
+	auto setPeriod(Period period) -> void;
+	auto getPeriod() const -> Period;
+	auto getTotalTicks() const -> std::int64_t;
+
+	/**
+	 * Runs all ticks which are due at the given point in time by calling step once per tick, at most mMaxTicksPerUpdate times.
+	 * The step may change the period, which applies to the following ticks of the same update.
+	 *
+	 * @param step Callable returning false if no further ticks should be run, e.g. because the game is over
+	 * @return The number of ticks run
+	 */
+	template<typename Step>
+	auto update(Clock::time_point now, Step&& step) -> std::int32_t;
+
+	/// Progress in [0,1] of the time passed between the last & the next tick
+	auto getTickProgress(Clock::time_point now) const -> double;
+	/// Time until the next tick is due, zero if it is already overdue
+	auto getTimeUntilNextTick(Clock::time_point now) const -> Period;
+
+ private:
+	auto getTickTime(std::int64_t tickSinceAnchor) const -> Clock::time_point;
+};
+
+template<typename Step>
+auto TickScheduler::update(const Clock::time_point now, Step&& step) -> std::int32_t
+{
+	std::int32_t ticksRun{ 0 };
+	while (getTickTime(mTicksSinceAnchor + 1) <= now)
+	{
+		if (ticksRun == mMaxTicksPerUpdate)
+		{
+			mConsoleLogger->warn("Game logic can't keep up with {:.4f}ms ticks, skipping the backlog", mPeriod.count());
+			mAnchor = now;
+			mTicksSinceAnchor = 0;
+			break;
+		}
+
+		++mTicksSinceAnchor;
+		++mTotalTicks;
+		++ticksRun;
+		if (!step())
+		{
+			break;
+		}
+	}
+	return ticksRun;
+}
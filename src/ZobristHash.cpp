@@ -0,0 +1,21 @@
+#include "ZobristHash.hpp"
+
+auto ZobristHash::hash(const std::deque<Snake::Point>& body, const Snake::Point& snack,
+	const Snake::Point& gameFrameDimension) -> std::uint64_t
+{
+	const std::int32_t width{ gameFrameDimension.first + 1 };
+	const auto toCell{ [width](const Snake::Point& point)
+	{
+	  return point.second * width + point.first;
+	} };
+
+	std::uint64_t hash{ ZobristHash::getSnackKey(toCell(snack)) };
+	for (std::size_t i{ 0 }; i + 1 < body.size(); ++i)
+	{
+		const auto segmentKind{ static_cast<std::uint8_t>(Snake::getDirectionBetween(body[i], body[i + 1])) };
+		hash ^= ZobristHash::getSegmentKey(toCell(body[i]), segmentKind);
+	}
+	hash ^= ZobristHash::getSegmentKey(toCell(body.back()), mTailSegment);
+
+	return hash;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Snake.hpp"
+
+#include <cstdint>
+
+/**
+ * Zobrist hashing of a game state (snake body & snack), shared by the offline solver & the games autopilot.
+ * Every body cell contributes the key of its direction towards the next segment closer to the tail, the last segment a
+ * tail key. This encodes the order of the body, while moving the snake only changes the keys of the head & tail cells.
+ */
+class ZobristHash
+{
+ public:
+	/// Segment kind of the last body cell, the Direction values 0-3 are used for all other cells
+	constexpr static std::uint8_t mTailSegment{ 4 };
+
+	/// Cells are numbered row by row, cell = y * width + x
+	constexpr static auto getSegmentKey(std::int32_t cell, std::uint8_t segmentKind) -> std::uint64_t
+	{
+		return ZobristHash::mix(static_cast<std::uint64_t>(cell) * 8 + segmentKind);
+	}
+
+	constexpr static auto getSnackKey(std::int32_t cell) -> std::uint64_t
+	{
+		return ZobristHash::mix(static_cast<std::uint64_t>(cell) * 8 + mTailSegment + 1);
+	}
+
+	/// Calculates the hash of a game from scratch, the game frame dimension like passed to the Snake
+	static auto hash(const std::deque<Snake::Point>& body, const Snake::Point& snack,
+		const Snake::Point& gameFrameDimension) -> std::uint64_t;
+
+ private:
+	/// SplitMix64 finalizer, computing the keys on the fly keeps them identical for every board size without a table
+	constexpr static auto mix(std::uint64_t index) -> std::uint64_t
+	{
+		std::uint64_t key{ index + 0x9E3779B97F4A7C15 };
+		key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9;
+		key = (key ^ (key >> 27)) * 0x94D049BB133111EB;
+		return key ^ (key >> 31);
+	}
+};
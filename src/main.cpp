@@ -1,15 +1,181 @@
 #include "SnakeGameFrame.hpp"
+#include "ReplayRenderer.hpp"
 
 #include <QApplication>
+#include <QGuiApplication>
+#include <QCommandLineParser>
 #include <QMainWindow>
 #include <QToolBar>
 #include <QStatusBar>
 #include <QBoxLayout>
+#include <spdlog/spdlog.h>
+#include <fmt/core.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <thread>
+
+namespace
+{
+	/// Options choosing the rules, the same for playing & rendering replays
+	auto addRuleOptions(QCommandLineParser& parser) -> void
+	{
+		parser.addOptions({
+			{ "map", "Map file with walls, sets the game frame dimension & the spawn point.", "file" },
+			{ "border", "What happens at the game frame border, wrap or solid.", "border", "wrap" }});
+	}
+
+	/// Empty if the options are invalid, which is already logged
+	auto parseRules(const QCommandLineParser& parser) -> std::optional<RuleSet>
+	{
+		RuleSet rules{};
+		const QString border{ parser.value("border").toLower() };
+		if (border == "solid")
+		{
+			rules.isSolidBorder = true;
+		}
+		else if (border != "wrap")
+		{
+			spdlog::error("Unknown border {}", border.toStdString());
+			return std::nullopt;
+		}
+
+		if (parser.isSet("map"))
+		{
+			try
+			{
+				rules.gameMap = std::make_shared<const GameMap>(GameMap::load(parser.value("map").toStdString()));
+			}
+			catch (const std::runtime_error&)
+			{
+				return std::nullopt; // Already logged
+			}
+		}
+		return rules;
+	}
+
+	/// Renders the replays passed on the command line into image files without opening a window
+	auto renderReplays(int argc, char* argv[]) -> int
+	{
+		// Rendering works without a display, a platform chosen by the user is kept
+		if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+		{
+			qputenv("QT_QPA_PLATFORM", "offscreen");
+		}
+		QGuiApplication app{ argc, argv };
+		// Logging every eaten snack slows down rendering thousands of frames, the summary is printed instead
+		spdlog::set_level(spdlog::level::warn);
+
+		QCommandLineParser parser{};
+		parser.setApplicationDescription("Renders snake replays into frame files");
+		parser.addHelpOption();
+		parser.addOptions({
+			{ "render-replays", "Directory the frames are written to.", "directory" },
+			{ "format", "Output format, one of png, ppm or raw.", "format", "ppm" },
+			{ "threads", "Number of replays rendered in parallel.", "count",
+			  QString::number(std::max(std::thread::hardware_concurrency(), 1U)) },
+			{ "frames-per-move", "Frames rendered per snake movement.", "count", "1" }});
+		addRuleOptions(parser);
+		parser.addPositionalArgument("replays", "Replay files to render.", "replays...");
+		parser.process(app);
+
+		const auto rules{ parseRules(parser) };
+		if (!rules)
+		{
+			return EXIT_FAILURE;
+		}
+
+		const QString format{ parser.value("format").toLower() };
+		ReplayRenderer::Format rendererFormat{ ReplayRenderer::Format::PPM };
+		if (format == "png")
+		{
+			rendererFormat = ReplayRenderer::Format::PNG;
+		}
+		else if (format == "raw")
+		{
+			rendererFormat = ReplayRenderer::Format::RAW;
+		}
+		else if (format != "ppm")
+		{
+			spdlog::error("Unknown format {}", format.toStdString());
+			return EXIT_FAILURE;
+		}
+
+		std::vector<std::filesystem::path> replayPaths{};
+		for (const QString& replayPath: parser.positionalArguments())
+		{
+			replayPaths.emplace_back(replayPath.toStdString());
+		}
+
+		ReplayRenderer renderer{ parser.value("render-replays").toStdString(), rendererFormat,
+		                         parser.value("frames-per-move").toInt(), *rules };
+		const ReplayRenderer::Result result{ renderer.render(replayPaths, parser.value("threads").toUInt()) };
+		fmt::print("Rendered {:d} frames of {:d} replays in {:.2f}s ({:.0f} frames/s)\n", result.framesWritten,
+			replayPaths.size() - result.failedReplays, result.renderTime.count(),
+			static_cast<double>(result.framesWritten) / result.renderTime.count());
+		return result.failedReplays == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+}
 
 auto main(int argc, char* argv[]) -> int
 {
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--render-replays") == 0)
+		{
+			return renderReplays(argc, argv);
+		}
+	}
+
 	QApplication app{ argc, argv };
 
+	QCommandLineParser parser{};
+	parser.addHelpOption();
+	parser.addOption({ "policy", "Policy file written by the snake_solver, used as autopilot.", "file" });
+	parser.addOption({ "seed", "Seed of the snack placement, makes the games reproducible.", "number" });
+	parser.addOption({ "dimension", "Game frame dimension like the snake_solver uses it, default 14,14 (a 15x15 board).",
+	                   "x,y" });
+	addRuleOptions(parser);
+	parser.process(app);
+
+	const auto rules{ parseRules(parser) };
+	if (!rules)
+	{
+		return EXIT_FAILURE;
+	}
+
+	Snake::Point gameFrameDimension{ 14, 14 };
+	if (parser.isSet("dimension"))
+	{
+		const QStringList dimension{ parser.value("dimension").split(',') };
+		bool isXNumber{ false };
+		bool isYNumber{ false };
+		if (dimension.size() == 2)
+		{
+			gameFrameDimension = { dimension[0].toInt(&isXNumber), dimension[1].toInt(&isYNumber) };
+		}
+		if (!isXNumber || !isYNumber || gameFrameDimension.first < 1 || gameFrameDimension.second < 1)
+		{
+			spdlog::error("The dimension {} is no pair of positive numbers like 14,14", parser.value("dimension")
+				.toStdString());
+			return EXIT_FAILURE;
+		}
+		if (rules->gameMap)
+		{
+			spdlog::warn("Ignoring the dimension, the map sets it");
+		}
+	}
+	try
+	{
+		static_cast<void>(rules->createSnake(rules->getGameFrameDimension(gameFrameDimension)));
+	}
+	catch (const std::runtime_error&)
+	{
+		return EXIT_FAILURE; // Already logged, the snake doesn't fit onto the board
+	}
+
 	QMainWindow mainWindow{};
 	mainWindow.setWindowTitle(QString{ "Snake Qt" });
 	// No needed due to the snake frame setting the window dimensions below
@@ -18,7 +184,29 @@ auto main(int argc, char* argv[]) -> int
 	QStatusBar gameStatusBar{ &mainWindow };
 	mainWindow.setStatusBar(&gameStatusBar);
 
-	SnakeGameFrame snakeGameFrame{ &mainWindow, &gameStatusBar };
+	SnakeGameFrame snakeGameFrame{ &mainWindow, &gameStatusBar, gameFrameDimension, *rules };
+	if (parser.isSet("policy"))
+	{
+		try
+		{
+			snakeGameFrame.setAutopilotPolicy(Policy::load(parser.value("policy").toStdString()));
+		}
+		catch (const std::runtime_error&)
+		{
+			// Already logged, the game is still playable without autopilot
+		}
+	}
+	if (parser.isSet("seed"))
+	{
+		bool isNumber{ false };
+		const qulonglong seed{ parser.value("seed").toULongLong(&isNumber) };
+		if (!isNumber)
+		{
+			spdlog::error("The seed {} is no positive number", parser.value("seed").toStdString());
+			return EXIT_FAILURE;
+		}
+		snakeGameFrame.setRandomSeed(seed);
+	}
 	// Using the game snakeGameFrame's size to determine the main window dimension
 	QSize snakeGameFrameSize{ snakeGameFrame.size() };
 	mainWindow.setGeometry(0, 0, snakeGameFrameSize.width(), snakeGameFrameSize.height()+ gameStatusBar.height());
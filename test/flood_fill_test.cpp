@@ -0,0 +1,181 @@
+#include "FloodFill.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <tuple>
+
+/// Plain breadth first search as reference for the bitboard kernel
+struct ReferenceBoard
+{
+	std::int32_t width;
+	std::int32_t height;
+	std::vector<bool> isBlocked;
+	/// Neighbours behind the border are on the other side, or don't exist like behind a solid border
+	bool isWrapping{ true };
+
+	auto fill(const Snake::Point& start) const -> std::vector<bool>
+	{
+		std::vector<bool> isReached(isBlocked.size(), false);
+		const auto index{ [&](const Snake::Point& point)
+		{
+		  return static_cast<std::size_t>(point.second * width + point.first);
+		} };
+		if (isBlocked[index(start)])
+		{
+			return isReached;
+		}
+
+		std::vector<Snake::Point> queue{ start };
+		isReached[index(start)] = true;
+		for (std::size_t i{ 0 }; i < queue.size(); ++i)
+		{
+			const auto [x, y] = queue[i];
+			for (const auto& [xNeighbour, yNeighbour]: { Snake::Point{ x, y - 1 }, Snake::Point{ x + 1, y },
+			                                             Snake::Point{ x, y + 1 }, Snake::Point{ x - 1, y }})
+			{
+				const bool isInside{ 0 <= xNeighbour && xNeighbour < width && 0 <= yNeighbour && yNeighbour < height };
+				if (!isWrapping && !isInside)
+				{
+					continue;
+				}
+				const Snake::Point neighbour{ (xNeighbour + width) % width, (yNeighbour + height) % height };
+				if (!isBlocked[index(neighbour)] && !isReached[index(neighbour)])
+				{
+					isReached[index(neighbour)] = true;
+					queue.push_back(neighbour);
+				}
+			}
+		}
+		return isReached;
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(flood_fill_test_suite);
+
+	using Topologies = std::tuple<Rules::WrapAround, Rules::SolidBorder>;
+
+	BOOST_AUTO_TEST_CASE_TEMPLATE(random_board_test, Topology, Topologies)
+	{
+		// Widths around the word size test the carries between words & the wrap around from the last to the first word.
+		// Two cells wide boards have the same left & right neighbour when wrapping, but none behind a solid border
+		std::mt19937 generator{ 42 };
+		for (const auto& dimension: { Snake::Point{ 0, 0 }, Snake::Point{ 1, 6 }, Snake::Point{ 14, 14 },
+		                              Snake::Point{ 63, 5 }, Snake::Point{ 64, 9 }, Snake::Point{ 199, 3 },
+		                              Snake::Point{ 255, 40 }})
+		{
+			for (const double density: { 0.1, 0.35, 0.5 })
+			{
+				ReferenceBoard reference{ dimension.first + 1, dimension.second + 1, {}, !Topology::mIsCrashingAtBorder };
+				BasicFloodFill<Topology> floodFill{ dimension };
+				std::bernoulli_distribution isBlocked{ density };
+				for (std::int32_t y{ 0 }; y < reference.height; ++y)
+				{
+					for (std::int32_t x{ 0 }; x < reference.width; ++x)
+					{
+						reference.isBlocked.push_back(isBlocked(generator));
+						floodFill.setBlocked({ x, y }, reference.isBlocked.back());
+					}
+				}
+
+				const Snake::Point start{ reference.width / 2, reference.height / 2 };
+				const auto isReached{ reference.fill(start) };
+				BOOST_TEST(floodFill.fill(start) == static_cast<std::size_t>(std::ranges::count(isReached, true)));
+				for (std::size_t i{ 0 }; i < isReached.size(); ++i)
+				{
+					const Snake::Point point{ static_cast<std::int32_t>(i) % reference.width,
+					                          static_cast<std::int32_t>(i) / reference.width };
+					BOOST_TEST(floodFill.isReached(point) == isReached[i]);
+				}
+
+				std::size_t freeCells{ 0 };
+				for (const auto size: floodFill.getRegionSizes())
+				{
+					freeCells += size;
+				}
+				BOOST_TEST(freeCells == static_cast<std::size_t>(std::ranges::count(reference.isBlocked, false)));
+			}
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(region_test)
+	{
+		// Two walls split the 8x4 board into two regions, the left one continues on the right side
+		FloodFill floodFill{{ 7, 3 }};
+		for (std::int32_t y{ 0 }; y < 4; ++y)
+		{
+			floodFill.setBlocked({ 2, y }, true);
+			floodFill.setBlocked({ 5, y }, true);
+		}
+		const std::vector<std::size_t> expected{ 16, 8 };
+		BOOST_TEST(floodFill.getRegionSizes() == expected, boost::test_tools::per_element());
+		BOOST_TEST(floodFill.fill({ 2, 0 }) == 0);
+		BOOST_TEST(floodFill.fill({ 7, 3 }) == 16);
+
+		floodFill.setBlocked({ 5, 1 }, false);
+		BOOST_TEST(floodFill.fill({ 3, 0 }) == 25);
+	}
+
+	BOOST_AUTO_TEST_CASE(snake_test)
+	{
+		// A snake spanning a whole row of the 5x5 board, the other rows stay connected around the border
+		Snake snake{{ 4, 4 }, { 4, 2 }, Snake::Direction::EAST, 5 };
+		FloodFill floodFill{{ 4, 4 }};
+		auto result{ floodFill.analyse(snake.getBody()) };
+		BOOST_TEST(result.reachableCells == 20);
+		BOOST_TEST(result.isTailReachable);
+
+		// Analysing restores the board, only the body was blocked
+		BOOST_TEST(floodFill.fill({ 0, 2 }) == 25);
+
+		// Walls on both sides of the head column separate it from the tail
+		Snake shortSnake{{ 4, 4 }, { 2, 2 }, Snake::Direction::EAST, 3 };
+		for (std::int32_t y{ 0 }; y < 5; ++y)
+		{
+			floodFill.setBlocked({ 1, y }, y != 2);
+			floodFill.setBlocked({ 3, y }, true);
+		}
+		result = floodFill.analyse(shortSnake.getBody());
+		BOOST_TEST(result.reachableCells == 4);
+		BOOST_TEST(!result.isTailReachable);
+
+		// Obstacles below the body stay blocked after analysing
+		floodFill.setBlocked({ 1, 2 }, true);
+		floodFill.analyse(shortSnake.getBody());
+		BOOST_TEST(floodFill.fill({ 1, 2 }) == 0);
+		BOOST_TEST(floodFill.fill({ 2, 2 }) == 5);
+	}
+
+	BOOST_AUTO_TEST_CASE(solid_border_test)
+	{
+		// The same walls as in the region_test, but the left region ends at the border
+		BasicFloodFill<Rules::SolidBorder> floodFill{{ 7, 3 }};
+		for (std::int32_t y{ 0 }; y < 4; ++y)
+		{
+			floodFill.setBlocked({ 2, y }, true);
+			floodFill.setBlocked({ 5, y }, true);
+		}
+		const std::vector<std::size_t> expected{ 8, 8, 8 };
+		BOOST_TEST(floodFill.getRegionSizes() == expected, boost::test_tools::per_element());
+		BOOST_TEST(floodFill.fill({ 7, 3 }) == 8);
+
+		// A snake along the left border of a 5x5 board with a wall in the middle column only reaches the column in between
+		std::deque<Snake::Point> body{};
+		for (std::int32_t y{ 0 }; y < 5; ++y)
+		{
+			body.emplace_back(0, y);
+		}
+		BasicFloodFill<Rules::SolidBorder> solidFloodFill{{ 4, 4 }};
+		FloodFill wrappingFloodFill{{ 4, 4 }};
+		for (std::int32_t y{ 0 }; y < 5; ++y)
+		{
+			solidFloodFill.setBlocked({ 2, y }, true);
+			wrappingFloodFill.setBlocked({ 2, y }, true);
+		}
+		const auto solidResult{ solidFloodFill.analyse(body) };
+		BOOST_TEST(solidResult.reachableCells == 5);
+		BOOST_TEST(solidResult.isTailReachable);
+		BOOST_TEST(wrappingFloodFill.analyse(body).reachableCells == 15);
+	}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,152 @@
+#include "Snake.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+/// 6x5 board with a wall in the middle column, the snake spawns left of it heading north
+struct MapFile
+{
+	std::filesystem::path path{ std::filesystem::temp_directory_path() / "snake_map_test.map" };
+	const std::vector<GameMap::Point> walls{{ 3, 1 }, { 3, 2 }, { 3, 3 }};
+	MapFile()
+	{
+		GameMap::save(path, { 5, 4 }, { 1, 2 }, static_cast<std::uint32_t>(Snake::Direction::NORTH), walls);
+	}
+	~MapFile()
+	{
+		std::filesystem::remove(path);
+	}
+	auto load() const -> std::shared_ptr<const GameMap>
+	{
+		return std::make_shared<const GameMap>(GameMap::load(path));
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(game_map_test_suite);
+
+	BOOST_FIXTURE_TEST_CASE(load_test, MapFile)
+	{
+		const auto gameMap{ load() };
+		BOOST_TEST((gameMap->getGameFrameDimension() == GameMap::Point{ 5, 4 }));
+		BOOST_TEST((gameMap->getSpawn() == GameMap::Point{ 1, 2 }));
+		BOOST_TEST(gameMap->getSpawnDirection() == static_cast<std::uint32_t>(Snake::Direction::NORTH));
+		BOOST_TEST(gameMap->getWallCount() == walls.size());
+		for (std::int32_t y{ 0 }; y <= 4; ++y)
+		{
+			for (std::int32_t x{ 0 }; x <= 5; ++x)
+			{
+				BOOST_TEST(gameMap->isWall({ x, y }) == (x == 3 && 1 <= y && y <= 3));
+			}
+		}
+	}
+
+	BOOST_FIXTURE_TEST_CASE(malformed_test, MapFile)
+	{
+		// Truncated bitmap
+		std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+		BOOST_CHECK_THROW(GameMap::load(path), std::runtime_error);
+
+		std::ofstream{ path } << "no map";
+		BOOST_CHECK_THROW(GameMap::load(path), std::runtime_error);
+
+		GameMap::save(path, { 5, 4 }, { 3, 2 }, 0, walls);
+		BOOST_CHECK_THROW(GameMap::load(path), std::runtime_error);
+		BOOST_CHECK_THROW(GameMap::save(path, { 5, 4 }, { 1, 2 }, 0, {{ 6, 0 }}), std::runtime_error);
+		BOOST_CHECK_THROW(GameMap::load(path.parent_path() / "missing.map"), std::runtime_error);
+	}
+
+	BOOST_AUTO_TEST_CASE(solid_border_test)
+	{
+		// Crashing into the border leaves the body untouched & is reverted by rewinding
+		BasicSnake<Rules::SolidBorder> snake{{ 4, 4 }, { 3, 2 }, Snake::Direction::EAST, 3 };
+		Snake::Point snack{ 0, 0 };
+		BOOST_TEST(!snake.move(snack));
+		BOOST_TEST(!snake.isDead());
+		const auto body{ snake.getBody() };
+		snake.move(snack);
+		BOOST_TEST(snake.isDead());
+		BOOST_TEST((snake.getBody() == body));
+
+		BOOST_TEST(snake.stepBack(snack));
+		BOOST_TEST(!snake.isDead());
+		snake.turn(Snake::Direction::SOUTH);
+		snake.move(snack);
+		BOOST_TEST(!snake.isDead());
+
+		// Spawning across the border is only possible when wrapping around
+		BOOST_CHECK_THROW((BasicSnake<Rules::SolidBorder>{{ 4, 4 }, { 1, 2 }, Snake::Direction::EAST, 3 }),
+			std::runtime_error);
+		Snake wrappingSnake{{ 4, 4 }, { 1, 2 }, Snake::Direction::EAST, 3 };
+		BOOST_TEST((wrappingSnake.getBody().back() == Snake::Point{ 4, 2 }));
+	}
+
+	BOOST_FIXTURE_TEST_CASE(obstacle_test, MapFile)
+	{
+		const auto gameMap{ load() };
+		auto snake{ BasicSnake<Rules::WrapAround, Rules::MapObstacles>::fromMap(gameMap, 2) };
+		BOOST_TEST((snake.getBody().front() == gameMap->getSpawn()));
+
+		// Snacks never spawn in walls
+		CounterRandomSource randomSource{ 3, 0 };
+		for (std::size_t i{ 0 }; i < 100; ++i)
+		{
+			BOOST_TEST(!gameMap->isWall(snake.generateSnack(randomSource)));
+		}
+
+		// Running into the wall east of the spawn
+		const Snake::Point snack{ 0, 0 };
+		snake.turn(Snake::Direction::EAST);
+		snake.move(snack);
+		BOOST_TEST(!snake.isDead());
+		snake.move(snack);
+		BOOST_TEST(snake.isDead());
+
+		// The same map with obstacles turned off only provides the spawn
+		auto openSnake{ BasicSnake<Rules::WrapAround, Rules::NoObstacles>::fromMap(gameMap, 2) };
+		openSnake.turn(Snake::Direction::EAST);
+		openSnake.move(snack);
+		openSnake.move(snack);
+		BOOST_TEST(!openSnake.isDead());
+		BOOST_TEST((openSnake.getBody().front() == Snake::Point{ 3, 2 }));
+	}
+
+	BOOST_FIXTURE_TEST_CASE(rule_set_test, MapFile)
+	{
+		// Without a map the board is empty & of the given size
+		RuleSet rules{};
+		BOOST_TEST((rules.getGameFrameDimension({ 9, 9 }) == Snake::Point{ 9, 9 }));
+		RuleSet::AnySnake snake{ rules.createSnake({ 9, 9 }) };
+		BOOST_TEST(std::holds_alternative<Snake>(snake));
+		BOOST_TEST((RuleSet::getBase(snake).getBody().front() == Snake::Point{ 4, 4 }));
+
+		// The map sets the dimension & spawn point, the border is chosen independently
+		rules = { false, load() };
+		BOOST_TEST((rules.getGameFrameDimension({ 9, 9 }) == Snake::Point{ 5, 4 }));
+		snake = rules.createSnake(rules.getGameFrameDimension({ 9, 9 }));
+		BOOST_TEST((std::holds_alternative<BasicSnake<Rules::WrapAround, Rules::MapObstacles>>(snake)));
+		BOOST_TEST((RuleSet::getBase(snake).getBody().front() == Snake::Point{ 1, 2 }));
+
+		// Running east out of the game frame crashes with a solid border
+		rules = { true, nullptr };
+		snake = rules.createSnake({ 9, 9 });
+		const auto isDeadAfterMoves{ [&](const std::size_t moves)
+		{
+		  const Snake::Point snack{ 0, 0 };
+		  for (std::size_t i{ 0 }; i < moves; ++i)
+		  {
+			  std::visit([&](auto& variant)
+			  {
+				variant.move(snack);
+			  }, snake);
+		  }
+		  return std::visit([](auto& variant)
+		  {
+			return variant.isDead();
+		  }, snake);
+		} };
+		BOOST_TEST(!isDeadAfterMoves(5));
+		BOOST_TEST(isDeadAfterMoves(1));
+	}
+
+BOOST_AUTO_TEST_SUITE_END();
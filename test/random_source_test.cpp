@@ -0,0 +1,92 @@
+#include "RandomSource.hpp"
+#include "Snake.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <limits>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(random_source_test_suite);
+
+	BOOST_AUTO_TEST_CASE(stream_test)
+	{
+		// The same seed & stream id always produce the same numbers, any other stream different ones
+		CounterRandomSource randomSource{ 42, 0 };
+		CounterRandomSource sameSource{ 42, 0 };
+		CounterRandomSource otherStream{ 42, 1 };
+		CounterRandomSource otherSeed{ 43, 0 };
+		std::vector<std::uint64_t> numbers{};
+		for (std::size_t i{ 0 }; i < 1000; ++i)
+		{
+			numbers.push_back(randomSource.next());
+			BOOST_TEST(numbers.back() == sameSource.next());
+			BOOST_TEST(numbers.back() != otherStream.next());
+			BOOST_TEST(numbers.back() != otherSeed.next());
+		}
+
+		// Jumping back replays the stream from there on
+		randomSource.setPosition(500);
+		BOOST_TEST(randomSource.getPosition() == 500);
+		BOOST_TEST(randomSource.next() == numbers[500]);
+	}
+
+	BOOST_AUTO_TEST_CASE(bounded_test)
+	{
+		CounterRandomSource randomSource{ 7, 7 };
+		std::array<std::size_t, 6> counts{};
+		constexpr std::size_t draws{ 60'000 };
+		for (std::size_t i{ 0 }; i < draws; ++i)
+		{
+			++counts[randomSource.nextBelow(6)];
+		}
+		// Every value about equally often, the expected deviation is ~90
+		for (const auto count: counts)
+		{
+			BOOST_TEST(count > draws / 6 - 500);
+			BOOST_TEST(count < draws / 6 + 500);
+		}
+
+		bool isLowDrawn{ false };
+		bool isHighDrawn{ false };
+		for (std::size_t i{ 0 }; i < 1000; ++i)
+		{
+			const std::int32_t value{ randomSource.nextInRange(-3, 3) };
+			BOOST_TEST((-3 <= value && value <= 3));
+			isLowDrawn |= value == -3;
+			isHighDrawn |= value == 3;
+			BOOST_TEST(randomSource.nextBelow(1) == 0);
+		}
+		BOOST_TEST(isLowDrawn);
+		BOOST_TEST(isHighDrawn);
+
+		// The size of the whole int32 range doesn't fit into 32 bits
+		constexpr std::int32_t low{ std::numeric_limits<std::int32_t>::min() };
+		constexpr std::int32_t high{ std::numeric_limits<std::int32_t>::max() };
+		bool isNegativeDrawn{ false };
+		bool isPositiveDrawn{ false };
+		for (std::size_t i{ 0 }; i < 1000; ++i)
+		{
+			const std::int32_t value{ randomSource.nextInRange(low, high) };
+			isNegativeDrawn |= value < 0;
+			isPositiveDrawn |= value > 0;
+		}
+		BOOST_TEST(isNegativeDrawn);
+		BOOST_TEST(isPositiveDrawn);
+	}
+
+	BOOST_AUTO_TEST_CASE(snack_test)
+	{
+		// Snacks never spawn in the snake & the same stream places them on the same positions
+		Snake snake{{ 3, 3 }, { 1, 1 }, Snake::Direction::EAST, 12 };
+		CounterRandomSource randomSource{ 1, 2 };
+		CounterRandomSource sameSource{ 1, 2 };
+		for (std::size_t i{ 0 }; i < 100; ++i)
+		{
+			const Snake::Point snack{ snake.generateSnack(randomSource) };
+			BOOST_TEST(!snake.isOnSnack(snack));
+			BOOST_TEST((snack == snake.generateSnack(sameSource)));
+		}
+	}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,108 @@
+#include "Replay.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <fmt/core.h>
+
+#include <fstream>
+
+struct ReplayFile
+{
+	std::filesystem::path path{ std::filesystem::temp_directory_path() / "snake_replay_test.replay" };
+	auto write(const std::string& content) -> void
+	{
+		std::ofstream{ path } << content;
+	}
+	auto teardown() -> void
+	{
+		std::filesystem::remove(path);
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(replay_test_suite);
+
+	BOOST_FIXTURE_TEST_CASE(load_test, ReplayFile)
+	{
+		write("# Test replay\n"
+		      "dimension 9 7\n"
+		      "snacks 1 2 3 4 # first snacks\n"
+		      "\n"
+		      "moves NNE SW\n"
+		      "snacks 5 6\n"
+		      "moves W\n");
+		const Replay replay{ Replay::load(path) };
+
+		BOOST_TEST((replay.gameFrameDimension == Snake::Point{ 9, 7 }));
+		const std::vector<Snake::Point> referenceSnacks{{ 1, 2 }, { 3, 4 }, { 5, 6 }};
+		BOOST_TEST((replay.snacks == referenceSnacks));
+		using enum Snake::Direction;
+		const std::vector<Snake::Direction> referenceMoves{ NORTH, NORTH, EAST, SOUTH, WEST, WEST };
+		BOOST_TEST((replay.moves == referenceMoves));
+		BOOST_TEST(!replay.seed.has_value());
+
+		write("seed 18446744073709551615 3\n");
+		const Replay seededReplay{ Replay::load(path) };
+		BOOST_TEST(seededReplay.seed.value_or(0) == 18446744073709551615U);
+		BOOST_TEST(seededReplay.gameId == 3);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(malformed_test, ReplayFile)
+	{
+		write("snacks 1 2 3\n");
+		BOOST_CHECK_THROW(Replay::load(path), std::runtime_error);
+		write("dimension 14\n");
+		BOOST_CHECK_THROW(Replay::load(path), std::runtime_error);
+		write("moves NEX\n");
+		BOOST_CHECK_THROW(Replay::load(path), std::runtime_error);
+		write("seed 42\n");
+		BOOST_CHECK_THROW(Replay::load(path), std::runtime_error);
+		write("snacks 1 2\nseed 42 0\n");
+		BOOST_CHECK_THROW(Replay::load(path), std::runtime_error);
+		write("speed 3\n");
+		BOOST_CHECK_THROW(Replay::load(path), std::runtime_error);
+		BOOST_CHECK_THROW(Replay::load(path.parent_path() / "missing.replay"), std::runtime_error);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(seeded_snacks_test, ReplayFile)
+	{
+		// Plays like the game: the snacks come from the stream of the seed & game id, the snake chases them
+		constexpr std::uint64_t seed{ 1234 };
+		constexpr std::uint64_t gameId{ 5 };
+		Snake liveSnake{{ 6, 6 }};
+		CounterRandomSource liveSource{ seed, gameId };
+		std::vector<Snake::Point> liveSnacks{ liveSnake.generateSnack(liveSource) };
+		std::string moves{};
+		for (std::size_t i{ 0 }; i < 200 && !liveSnake.isDead(); ++i)
+		{
+			const auto [xHead, yHead] = liveSnake.getBody().front();
+			const auto [xSnack, ySnack] = liveSnacks.back();
+			using enum Snake::Direction;
+			const auto direction{ xHead != xSnack ? (xHead < xSnack ? EAST : WEST) : (yHead < ySnack ? SOUTH : NORTH) };
+			moves += "NESW"[static_cast<std::size_t>(direction)];
+
+			liveSnake.turn(direction);
+			if (liveSnake.move(liveSnacks.back()))
+			{
+				liveSnacks.push_back(liveSnake.generateSnack(liveSource));
+			}
+		}
+		BOOST_TEST(liveSnacks.size() > 3);
+
+		// Replaying the moves with the logged seed & game id has to place the same snacks
+		write(fmt::format("dimension 6 6\nseed {:d} {:d}\nmoves {}\n", seed, gameId, moves));
+		const Replay replay{ Replay::load(path) };
+		ReplaySnacks replaySnacks{ replay };
+		Snake snake{ replay.gameFrameDimension };
+		std::vector<Snake::Point> snacks{ *replaySnacks.next(snake) };
+		for (const auto direction: replay.moves)
+		{
+			snake.turn(direction);
+			if (snake.move(snacks.back()))
+			{
+				snacks.push_back(*replaySnacks.next(snake));
+			}
+		}
+		BOOST_TEST((snacks == liveSnacks));
+	}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -168,6 +168,19 @@ BOOST_AUTO_TEST_SUITE(main_test_suite);
 		BOOST_TEST(referenceBody == snake.getBody());
 	}
 
+	BOOST_FIXTURE_TEST_CASE(previous_tail_test, DefaultSnake)
+	{
+		BOOST_TEST((snake.getPreviousTail() == Snake::Point{ 5, 7 }));
+
+		snake.move({ 0, 0 });
+		BOOST_TEST((snake.getPreviousTail() == Snake::Point{ 5, 7 }));
+		BOOST_TEST((snake.getBody().back() == Snake::Point{ 5, 6 }));
+
+		// Growing snake keeps its tail
+		snake.move({ 5, 3 });
+		BOOST_TEST((snake.getPreviousTail() == snake.getBody().back()));
+	}
+
 	BOOST_FIXTURE_TEST_CASE(eat_itself_test, LongSnake)
 	{
 		//fmt::print("Initial snake: {}\n",snake.getBody());
@@ -191,4 +204,62 @@ BOOST_AUTO_TEST_SUITE(main_test_suite);
 		BOOST_TEST(referenceBody == snake.getBody());
 	}
 
+	BOOST_FIXTURE_TEST_CASE(rewind_test, DefaultSnake)
+	{
+		struct State
+		{
+			std::deque<Snake::Point> body;
+			std::int32_t level;
+			double speed;
+		};
+		std::vector<State> states{{ snake.getBody(), snake.getLevel(), snake.getSpeed() }};
+
+		// Eating enough snacks for a level up, turning & moving around the border
+		const std::vector<Snake::Point> snacks{{ 5, 4 }, { 5, 3 }, { 5, 2 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+		                                       { 4, 10 }, { 0, 0 }, { 0, 0 }};
+		for (std::size_t i{ 0 }; i < snacks.size(); ++i)
+		{
+			if (i == 6)
+			{
+				snake.turnLeft();
+			}
+			snake.move(snacks[i]);
+			states.push_back({ snake.getBody(), snake.getLevel(), snake.getSpeed() });
+		}
+		BOOST_TEST(snake.getLevel() == 2);
+
+		Snake::Point snack{ 1, 1 };
+		for (std::size_t i{ snacks.size() }; i-- > 0;)
+		{
+			BOOST_TEST(snake.stepBack(snack));
+			BOOST_TEST(states[i].body == snake.getBody());
+			BOOST_TEST(states[i].level == snake.getLevel());
+			BOOST_TEST(states[i].speed == snake.getSpeed());
+			if (snacks[i] != Snake::Point{ 0, 0 })
+			{
+				BOOST_TEST((snack == snacks[i]));
+			}
+		}
+		BOOST_TEST(!snake.canStepBack());
+		BOOST_TEST(!snake.stepBack(snack));
+
+		// The view direction was restored, so the snake moves north like before
+		snake.move({ 0, 0 });
+		BOOST_TEST((snake.getBody().front() == Snake::Point{ 5, 4 }));
+	}
+
+	BOOST_AUTO_TEST_CASE(rewind_capacity_test)
+	{
+		Snake snake{{ 10, 10 }, { 5, 5 }, Snake::Direction::EAST, 4, 3, 2 };
+		snake.move({ 0, 0 });
+		snake.move({ 0, 0 });
+		snake.move({ 0, 0 });
+
+		Snake::Point snack{ 0, 0 };
+		BOOST_TEST(snake.stepBack(snack));
+		BOOST_TEST(snake.stepBack(snack));
+		BOOST_TEST(!snake.stepBack(snack));
+		BOOST_TEST((snake.getBody().front() == Snake::Point{ 6, 5 }));
+	}
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
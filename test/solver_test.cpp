@@ -0,0 +1,125 @@
+#include "Solver.hpp"
+#include "ZobristHash.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+struct SmallBoard
+{
+	Snake::Point gameFrameDimension{ 3, 3 };
+	BitboardState::Board board{ gameFrameDimension };
+	Snake snake{ gameFrameDimension, { 1, 1 }, Snake::Direction::EAST, 3 };
+	BitboardState state{ board, { 1, 1 }, Snake::Direction::EAST, 3 };
+	auto setup() -> void
+	{
+		BOOST_TEST_MESSAGE("> Constructing Small Board");
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(solver_test_suite);
+
+	BOOST_FIXTURE_TEST_CASE(incremental_hash_test, SmallBoard)
+	{
+		// Moving around the borders, eating & growing must keep both representations in sync
+		using enum Snake::Direction;
+		const std::vector<Snake::Direction> moves{ EAST, EAST, NORTH, NORTH, WEST, WEST, SOUTH, WEST };
+		std::vector<Snake::Point> snacks{{ 2, 1 }, { 3, 3 }, { 0, 2 }};
+		Snake::Point snack{ snacks.front() };
+		state.placeSnack(board.toCell(snack));
+
+		for (const auto direction: moves)
+		{
+			BOOST_TEST(state.getHash() == ZobristHash::hash(snake.getBody(), snack, gameFrameDimension));
+
+			snake.turn(direction);
+			const bool ateSnack{ snake.move(snack) };
+			BOOST_TEST((state.move(board, direction) == (ateSnack ? BitboardState::MoveResult::ATE_SNACK
+			                                                       : BitboardState::MoveResult::MOVED)));
+			BOOST_TEST(state.getLength() == static_cast<std::int32_t>(snake.getLength()));
+			if (ateSnack)
+			{
+				snacks.erase(snacks.begin());
+				snack = snacks.front();
+				state.placeSnack(board.toCell(snack));
+			}
+		}
+		BOOST_TEST(snacks.size() == 1);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(dying_test, SmallBoard)
+	{
+		// Moving into the cell the tail leaves is fine
+		state.placeSnack(board.toCell({ 3, 3 }));
+		BOOST_TEST((state.move(board, Snake::Direction::SOUTH) == BitboardState::MoveResult::MOVED));
+		BOOST_TEST((state.move(board, Snake::Direction::WEST) == BitboardState::MoveResult::MOVED));
+		BOOST_TEST((state.move(board, Snake::Direction::NORTH) == BitboardState::MoveResult::MOVED));
+
+		const BitboardState::Board largerBoard{{ 4, 4 }};
+		BitboardState longState{ largerBoard, { 2, 2 }, Snake::Direction::EAST, 5 };
+		longState.placeSnack(largerBoard.toCell({ 4, 4 }));
+		BOOST_TEST((longState.move(largerBoard, Snake::Direction::SOUTH) == BitboardState::MoveResult::MOVED));
+		BOOST_TEST((longState.move(largerBoard, Snake::Direction::WEST) == BitboardState::MoveResult::MOVED));
+		BOOST_TEST((longState.move(largerBoard, Snake::Direction::NORTH) == BitboardState::MoveResult::DIED));
+	}
+
+	BOOST_FIXTURE_TEST_CASE(solve_test, SmallBoard)
+	{
+		// Lazy SMP must not change the result, only how fast it is found
+		Solver singleThreaded{ gameFrameDimension, Solver::Objective::GUARANTEED_LENGTH, 4 };
+		Solver multiThreaded{ gameFrameDimension, Solver::Objective::GUARANTEED_LENGTH, 4 };
+		const auto result{ singleThreaded.solve(state, 6, 1) };
+		BOOST_TEST(result.value == multiThreaded.solve(state, 6, 4).value);
+		BOOST_TEST(result.value >= 3);
+
+		// Snacks spawning next to the head can't be worse than the worst case
+		Solver bestCase{ gameFrameDimension, Solver::Objective::BEST_CASE_LENGTH, 4 };
+		BOOST_TEST(bestCase.solve(state, 6, 2).value >= result.value);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(policy_test, SmallBoard)
+	{
+		Solver solver{ gameFrameDimension, Solver::Objective::GUARANTEED_LENGTH, 4 };
+		solver.solve(state, 6, 2);
+		const Policy policy{ solver.exportPolicy() };
+		BOOST_TEST(policy.getSize() > 0);
+
+		const auto path{ std::filesystem::temp_directory_path() / "snake_solver_test.policy" };
+		policy.save(path);
+		const Policy loadedPolicy{ Policy::load(path) };
+		BOOST_TEST((loadedPolicy.getGameFrameDimension() == gameFrameDimension));
+		BOOST_TEST(loadedPolicy.getSize() == policy.getSize());
+
+		// An entry count larger than the file is rejected before allocating the entries
+		{
+			std::fstream policyFile{ path, std::ios::binary | std::ios::in | std::ios::out };
+			policyFile.seekp(16);
+			const std::uint64_t corruptCount{ std::uint64_t{ 1 } << 62 };
+			policyFile.write(reinterpret_cast<const char*>(&corruptCount), sizeof(corruptCount));
+		}
+		BOOST_CHECK_THROW(Policy::load(path), std::runtime_error);
+		std::filesystem::remove(path);
+
+		// The autopilot finds a move for the game after the first snack spawned, at least for the worst placed snack whose
+		// value is exact. Only moves the snake survives with are exported
+		std::size_t knownSnacks{ 0 };
+		for (std::int32_t x{ 0 }; x <= gameFrameDimension.first; ++x)
+		{
+			for (std::int32_t y{ 0 }; y <= gameFrameDimension.second; ++y)
+			{
+				const Snake::Point snack{ x, y };
+				if (snake.isOnSnack(snack))
+				{
+					continue;
+				}
+				if (const auto entry{ loadedPolicy.lookup(ZobristHash::hash(snake.getBody(), snack, gameFrameDimension)) })
+				{
+					BOOST_TEST(entry->value >= 3);
+					++knownSnacks;
+				}
+			}
+		}
+		BOOST_TEST(knownSnacks > 0);
+	}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,83 @@
+#include "TickScheduler.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std::chrono_literals;
+
+struct DefaultScheduler
+{
+	TickScheduler::Clock::time_point start{};
+	TickScheduler scheduler{ TickScheduler::Period{ 0.25 }};
+	auto setup() -> void
+	{
+		BOOST_TEST_MESSAGE("> Starting Default Scheduler");
+		scheduler.start(start);
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(tick_scheduler_test_suite);
+
+	BOOST_FIXTURE_TEST_CASE(fractional_period_test, DefaultScheduler)
+	{
+		std::int64_t steps{ 0 };
+		const auto countStep{ [&]
+		{
+		  ++steps;
+		  return true;
+		} };
+
+		// Nothing is due before the first period passed
+		BOOST_TEST(scheduler.update(start + 200us, countStep) == 0);
+		BOOST_TEST(scheduler.update(start + 250us, countStep) == 1);
+		// Multiple ticks are run by one update if the event loop woke up late
+		BOOST_TEST(scheduler.update(start + 1ms, countStep) == 3);
+		BOOST_TEST(steps == 4);
+		BOOST_TEST(scheduler.getTickProgress(start + 1ms + 125us) == 0.5);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(no_drift_test, DefaultScheduler)
+	{
+		// A period not representable in whole nanoseconds, waking up every millisecond for an hour
+		scheduler.setPeriod(TickScheduler::Period{ 1.0 / 3.0 });
+		std::int64_t steps{ 0 };
+		for (auto now{ start }; now <= start + 1h; now += 1ms)
+		{
+			scheduler.update(now, [&]
+			{
+			  ++steps;
+			  return true;
+			});
+		}
+		BOOST_TEST(steps == 3 * 60 * 60 * 1'000);
+		BOOST_TEST(scheduler.getTotalTicks() == steps);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(period_change_test, DefaultScheduler)
+	{
+		// The step speeding up the ticks applies to the following ticks of the same update
+		const auto speedUp{ [&]
+		{
+		  scheduler.setPeriod(TickScheduler::Period{ 0.125 });
+		  return true;
+		} };
+		BOOST_TEST(scheduler.update(start + 500us, speedUp) == 3);
+		BOOST_TEST((scheduler.getTimeUntilNextTick(start + 500us) == TickScheduler::Period{ 0.125 }));
+	}
+
+	BOOST_FIXTURE_TEST_CASE(stop_and_catch_up_test, DefaultScheduler)
+	{
+		std::int64_t steps{ 0 };
+		BOOST_TEST(scheduler.update(start + 1ms, [&]
+		{
+		  return ++steps < 2;
+		}) == 2);
+
+		// After a stall the backlog is dropped instead of running every missed tick
+		BOOST_TEST(scheduler.update(start + 10s, [&]
+		{
+		  return true;
+		}) == 32);
+		BOOST_TEST((scheduler.getTimeUntilNextTick(start + 10s) == TickScheduler::Period{ 0.25 }));
+	}
+
+BOOST_AUTO_TEST_SUITE_END();